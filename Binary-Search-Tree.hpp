@@ -18,6 +18,9 @@
 #define BINARY_SEARCH_TREE_H
 
 #include <memory>
+#include <memory_resource>
+#include <vector>
+#include "Serialization.hpp"
 
 template <typename KEY, typename VALUE>
 struct BST_Node
@@ -26,13 +29,14 @@ struct BST_Node
     KEY   first;
     VALUE second;
 
-    // Pointers to other BST_Nodes in the Tree
-    std::shared_ptr<BST_Node<KEY, VALUE>> parent; 
+    // Pointers to other BST_Nodes in the Tree. The parent link is weak, so a
+    // parent and child don't keep each other alive after the tree lets go.
+    std::weak_ptr<BST_Node<KEY, VALUE>>   parent; 
     std::shared_ptr<BST_Node<KEY, VALUE>> left;
     std::shared_ptr<BST_Node<KEY, VALUE>> right;
 
     BST_Node() = default;
-    BST_Node(KEY key, VALUE val) : first(key), second(val), parent(nullptr), 
+    BST_Node(KEY key, VALUE val) : first(key), second(val), parent(), 
                                left(nullptr), right(nullptr) {}
 };
 
@@ -40,7 +44,13 @@ template <typename KEY, typename VALUE>
 class BST
 {
     public:
-        BST() : root_(nullptr), size_(0) {}
+        BST() : BST(std::pmr::get_default_resource()) {}
+        // Allocates every node from the given resource, which has to outlive the tree
+        BST(std::pmr::memory_resource* resource) : resource_(resource), root_(nullptr), size_(0) {}
+
+        // Binary save/load, see Serialization.hpp for the format
+        void save(std::ostream& out) const;
+        void load(std::istream& in);
 
         // Traversals
         // void Preorder();
@@ -53,7 +63,162 @@ class BST
 
 
     private:
+        std::pmr::memory_resource* resource_; // Where the nodes are allocated from
+
         std::shared_ptr<BST_Node<KEY, VALUE>> root_;
         size_t size_;
+
+        // What one saved element looks like, used to check the element size
+        struct Entry
+        {
+            KEY   first;
+            VALUE second;
+        };
+
+        // Puts a node in its sorted place, replacing the value of an equal key
+        void insertNode(KEY key, VALUE val);
+
+        // Allocates a node (and its control block) from resource_
+        std::shared_ptr<BST_Node<KEY, VALUE>> createNode(KEY key, VALUE val)
+        {
+            return std::allocate_shared<BST_Node<KEY, VALUE>>(
+                std::pmr::polymorphic_allocator<BST_Node<KEY, VALUE>>(resource_), key, val);
+        }
 };
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* SERIALIZATION                                                                                                      */
+/*====================================================================================================================*/
+
+/*************************************************************************** 
+ * Function: save
+ * Description:
+ *      Writes the tree to a binary stream as key/value pairs in preorder
+ *      (parents before their children), so loading them back in the same
+ *      order rebuilds the exact same shape. Uses its own stack instead of
+ *      recursion, so deep trees can't overflow the call stack.
+ * Parameters:
+ *      std::ostream& out : stream to write to (open it in binary mode)
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename KEY, typename VALUE>
+void BST<KEY, VALUE>::save(std::ostream& out) const
+{
+    writeHeader<Entry>(out, ContainerTag::BST, size_);
+
+    std::vector<BST_Node<KEY, VALUE>*> pending;
+    if(root_)
+        pending.push_back(root_.get());
+
+    while(!pending.empty())
+    {
+        BST_Node<KEY, VALUE>* node = pending.back();
+        pending.pop_back();
+
+        writeElement(out, node->first);
+        writeElement(out, node->second);
+
+        // Right first, so the left subtree comes out first
+        if(node->right)
+            pending.push_back(node->right.get());
+        if(node->left)
+            pending.push_back(node->left.get());
+    }
+}
+
+/*************************************************************************** 
+ * Function: load
+ * Description:
+ *      Replaces the contents of the tree with a tree written by save().
+ * Parameters:
+ *      std::istream& in : stream to read from (open it in binary mode)
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename KEY, typename VALUE>
+void BST<KEY, VALUE>::load(std::istream& in)
+{
+    uint64_t count = readHeader<Entry>(in, ContainerTag::BST);
+
+    root_ = nullptr;
+    size_ = 0;
+
+    for(uint64_t index = 0; index < count; index++)
+    {
+        KEY key;
+        VALUE val;
+        readElement(in, key);
+        readElement(in, val);
+        insertNode(std::move(key), std::move(val));
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF SERIALIZATION                                                                                               */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/*************************************************************************** 
+ * Function: insertNode
+ * Description:
+ *      Walks down from the root (left if smaller, right if bigger) and hangs
+ *      a new node where the walk falls off the tree. An equal key just gets
+ *      its value replaced, like std::map.
+ * Parameters:
+ *      KEY key   : key of the new node
+ *      VALUE val : value of the new node
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename KEY, typename VALUE>
+void BST<KEY, VALUE>::insertNode(KEY key, VALUE val)
+{
+    std::shared_ptr<BST_Node<KEY, VALUE>> parent;
+    std::shared_ptr<BST_Node<KEY, VALUE>> position = root_;
+
+    while(position)
+    {
+        if(!(key < position->first) && !(position->first < key))
+        {
+            position->second = std::move(val);
+            return;
+        }
+
+        parent = position;
+        position = key < position->first ? position->left : position->right;
+    }
+
+    std::shared_ptr<BST_Node<KEY, VALUE>> to_add = createNode(key, std::move(val));
+    to_add->parent = parent;
+
+    if(!parent)
+        root_ = to_add;
+    else if(key < parent->first)
+        parent->left = to_add;
+    else
+        parent->right = to_add;
+
+    size_++;
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
 #endif //BINARY_SEARCH_TREE_H
\ No newline at end of file
@@ -0,0 +1,479 @@
+/*************************************************************************************************
+* File: Concurrent-Linked-List.hpp
+* Description:
+*       A lock-free sorted singly linked list that any number of threads can insert into, remove
+*       from and search at the same time (Harris' list, with Michael's way of unlinking).
+*
+*       The list keeps its elements sorted by operator< with no duplicates, so it works as a
+*       concurrent set. That's what makes it lock-free: every thread agrees on where an element
+*       belongs, so an insert is a single compare-and-swap of one next pointer. A position
+*       handed out by one thread (like SLL's Node<DATA>*) could be removed by another before it
+*       is used, so there's no insert_after; insert() finds the position itself.
+*
+*       Removing is done in two steps. First the node's own next pointer gets its lowest bit set
+*       (it's "marked"), which removes it logically and stops anybody from inserting after it.
+*       Then it is unlinked from its predecessor, by the remover or by any thread that walks by.
+*       Unlinked nodes are retired to the EpochDomain (see Epoch-Reclamation.hpp) and freed
+*       once no thread can still be reading them, so there's no reference counting anywhere.
+*
+*       Like SLL, the nodes come from the process wide NodePoolResource.
+*
+*       insert, remove, search and size are thread safe. print, clear and the destructor aren't:
+*       call them only when no other thread is using the list.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17 -pthread)
+*
+*       For the algorithm, refer to the following:
+*       Link: https://timharris.uk/papers/2001-disc.pdf
+*       Link: https://dl.acm.org/doi/10.1145/564870.564881 (Michael, High Performance Dynamic
+*             Lock-Free Hash Tables and List-Based Sets)
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef CONCURRENT_LINKED_LIST_H
+#define CONCURRENT_LINKED_LIST_H
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include "Memory-Resources.hpp"
+#include "Epoch-Reclamation.hpp"
+
+template <typename DATA>
+struct ConcurrentNode
+{
+    DATA data; // Element in the Node
+    std::atomic<uintptr_t> next; // Pointer to the next Node, lowest bit set = this node is removed
+
+    template <typename... ARGS>
+    ConcurrentNode(std::in_place_t, ARGS&&... args) : data(std::forward<ARGS>(args)...), next(0) {}
+};
+
+template <typename DATA>
+class ConcurrentSLL
+{
+    public:
+        // Default Constructor
+        ConcurrentSLL();
+        // Destructor
+        ~ConcurrentSLL();
+
+        // Not copyable: there's no consistent moment to copy a list others are changing
+        ConcurrentSLL(const ConcurrentSLL&) = delete;
+        ConcurrentSLL& operator=(const ConcurrentSLL&) = delete;
+
+        // Mutators (thread safe)
+        bool insert(const DATA&); // false if the element was already there
+        bool insert(DATA&&);
+        bool remove(const DATA&); // false if the element wasn't there
+
+        // Accessors (thread safe)
+        bool search(const DATA&) const;
+        size_t size() const; // Exact when nothing is changing the list
+
+        // Not thread safe
+        void clear();
+        void print();
+
+    private:
+        using Node = ConcurrentNode<DATA>;
+
+        // Harris's marked pointers
+        static Node* pointer(uintptr_t link) { return reinterpret_cast<Node*>(link & ~uintptr_t(1)); }
+        static bool marked(uintptr_t link) { return link & 1; }
+        static uintptr_t link(Node* node, bool mark = false) { return reinterpret_cast<uintptr_t>(node) | uintptr_t(mark); }
+
+        Node* head_; // Sentinel, holds no element
+        std::atomic<size_t> size_;
+
+        bool insertNode(Node* node);
+        // Finds the first node not less than element, unlinking marked nodes on the way
+        bool find(const DATA& element, Node*& previous, Node*& current);
+        template <typename... ARGS>
+        static Node* createNode(ARGS&&...);
+        static void destroyNode(void* node);
+};
+
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS AND DESTRUCTOR                                                                                        */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: ConcurrentSLL
+ * Description:
+ *      Creates an empty list.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+ConcurrentSLL<DATA>::ConcurrentSLL() : head_(nullptr), size_(0)
+{
+    std::pmr::polymorphic_allocator<Node> allocator(&NodePoolResource::instance());
+    head_ = allocator.allocate(1);
+
+    // Only the link of the sentinel is ever used, its element is never built
+    ::new (static_cast<void*>(&head_->next)) std::atomic<uintptr_t>(0);
+}
+
+/***************************************************************************
+ * Function: ~ConcurrentSLL
+ * Description:
+ *      Frees every node still linked in. Nodes already unlinked are the
+ *      EpochDomain's to free.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+ConcurrentSLL<DATA>::~ConcurrentSLL()
+{
+    clear();
+
+    std::pmr::polymorphic_allocator<Node> allocator(&NodePoolResource::instance());
+    allocator.deallocate(head_, 1);
+}
+
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS AND DESTRUCTOR                                                                                 */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: insert
+ * Description:
+ *      Inserts a copy of an element in its sorted place, unless an equal
+ *      element is already in the list.
+ * Parameters:
+ *      const DATA& element : The desired element to be placed into the list
+ * Return:
+ *      bool : true if it was inserted
+***************************************************************************/
+template <typename DATA>
+bool ConcurrentSLL<DATA>::insert(const DATA& element)
+{
+    return insertNode(createNode(element));
+}
+
+/***************************************************************************
+ * Function: insert
+ * Description:
+ *      Moves an element into its sorted place, unless an equal element is
+ *      already in the list.
+ * Parameters:
+ *      DATA&& element : The desired element to be placed into the list
+ * Return:
+ *      bool : true if it was inserted
+***************************************************************************/
+template <typename DATA>
+bool ConcurrentSLL<DATA>::insert(DATA&& element)
+{
+    return insertNode(createNode(std::move(element)));
+}
+
+/***************************************************************************
+ * Function: remove
+ * Description:
+ *      Removes an element: marks its node's next pointer, which is the
+ *      moment it leaves the list, then tries once to unlink the node. If
+ *      another thread got in the way, find() unlinks it instead.
+ * Parameters:
+ *      const DATA& element : the element to remove
+ * Return:
+ *      bool : true if this call removed it
+***************************************************************************/
+template <typename DATA>
+bool ConcurrentSLL<DATA>::remove(const DATA& element)
+{
+    EpochDomain::Guard guard;
+
+    Node* previous;
+    Node* current;
+    while(true)
+    {
+        if(!find(element, previous, current))
+            return false;
+
+        uintptr_t next = current->next.load(std::memory_order_acquire);
+        if(marked(next))
+            continue; // somebody else is removing it, find() will clean up
+
+        if(!current->next.compare_exchange_strong(next, next | 1, std::memory_order_acq_rel))
+            continue;
+
+        size_.fetch_sub(1, std::memory_order_relaxed);
+
+        uintptr_t expected = link(current);
+        if(previous->next.compare_exchange_strong(expected, next, std::memory_order_acq_rel))
+            EpochDomain::instance().retire(current, destroyNode);
+        else
+            find(element, previous, current);
+
+        return true;
+    }
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Frees every node. Not thread safe.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void ConcurrentSLL<DATA>::clear()
+{
+    Node* node = pointer(head_->next.load(std::memory_order_acquire));
+    while(node)
+    {
+        Node* next = pointer(node->next.load(std::memory_order_relaxed));
+        destroyNode(node);
+        node = next;
+    }
+
+    head_->next.store(0, std::memory_order_release);
+    size_.store(0, std::memory_order_relaxed);
+}
+
+/*====================================================================================================================*/
+/* END OF MUTATORS                                                                                                    */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: search
+ * Description:
+ *      Looks for an element. Never writes to the list and never retries, so
+ *      searches don't slow down writers or each other.
+ * Parameters:
+ *      const DATA& element : the element to try to find in the list.
+ * Return:
+ *      bool : true if the element is in the list (and not being removed)
+***************************************************************************/
+template <typename DATA>
+bool ConcurrentSLL<DATA>::search(const DATA& element) const
+{
+    EpochDomain::Guard guard;
+
+    Node* current = pointer(head_->next.load(std::memory_order_acquire));
+    while(current && current->data < element)
+        current = pointer(current->next.load(std::memory_order_acquire));
+
+    return current && !(element < current->data) && !marked(current->next.load(std::memory_order_acquire));
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the number of elements. While other threads are inserting or
+ *      removing it is only a snapshot.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : size of the list
+***************************************************************************/
+template <typename DATA>
+size_t ConcurrentSLL<DATA>::size() const
+{
+    return size_.load(std::memory_order_relaxed);
+}
+
+/***************************************************************************
+ * Function: print
+ * Description:
+ *      Prints the list starting from the head, the same way SLL does. Not
+ *      thread safe.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void ConcurrentSLL<DATA>::print()
+{
+    if(size() == 0) return;// cannot print an empty list!
+    std::cout << "\n";// formatting
+
+    std::cout << "[HEAD]-> ";
+    for(Node* node = pointer(head_->next.load()); node; node = pointer(node->next.load()))
+        if(!marked(node->next.load()))
+            std::cout << node->data << "-> ";
+    std::cout << "[TAIL]-> nullptr\n";
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: insertNode
+ * Description:
+ *      Links a new node in between the last node less than its element and
+ *      the one after it, with one compare-and-swap. If the list changed
+ *      there in the meantime, it looks for the place again. The node is
+ *      freed if its element is already in the list.
+ * Parameters:
+ *      Node* node : the new node
+ * Return:
+ *      bool : true if the node was linked in
+***************************************************************************/
+template <typename DATA>
+bool ConcurrentSLL<DATA>::insertNode(Node* node)
+{
+    EpochDomain::Guard guard;
+
+    Node* previous;
+    Node* current;
+    while(true)
+    {
+        if(find(node->data, previous, current))
+        {
+            // Nobody else ever saw the node, so it can go right away
+            destroyNode(node);
+            return false;
+        }
+
+        node->next.store(link(current), std::memory_order_relaxed);
+
+        uintptr_t expected = link(current);
+        if(previous->next.compare_exchange_strong(expected, link(node), std::memory_order_release, std::memory_order_relaxed))
+        {
+            size_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+/***************************************************************************
+ * Function: find
+ * Description:
+ *      Walks to the first node whose element isn't less than the given one.
+ *      Marked nodes found on the way are unlinked and retired; if that fails
+ *      because previous changed, the walk starts over. Must be called
+ *      inside a Guard.
+ * Parameters:
+ *      const DATA& element : the element to look for
+ *      Node*& previous     : set to the last unmarked node before current
+ *      Node*& current      : set to the first node not less than element,
+ *                            nullptr if there is none
+ * Return:
+ *      bool : true if current holds an equal element
+***************************************************************************/
+template <typename DATA>
+bool ConcurrentSLL<DATA>::find(const DATA& element, Node*& previous, Node*& current)
+{
+retry:
+    previous = head_;
+    current = pointer(previous->next.load(std::memory_order_acquire));
+
+    while(current)
+    {
+        uintptr_t next = current->next.load(std::memory_order_acquire);
+        if(marked(next))
+        {
+            // current was removed, help unlink it. This fails if previous
+            // got removed too, or something was inserted after it.
+            uintptr_t expected = link(current);
+            if(!previous->next.compare_exchange_strong(expected, link(pointer(next)), std::memory_order_acq_rel))
+                goto retry;
+
+            EpochDomain::instance().retire(current, destroyNode);
+            current = pointer(next);
+            continue;
+        }
+
+        if(!(current->data < element))
+            return !(element < current->data);
+
+        previous = current;
+        current = pointer(next);
+    }
+    return false;
+}
+
+/***************************************************************************
+ * Function: createNode
+ * Description:
+ *      Creates a new node from the node pool.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      Node* : the new node, not linked to anything
+***************************************************************************/
+template <typename DATA>
+template <typename... ARGS>
+typename ConcurrentSLL<DATA>::Node* ConcurrentSLL<DATA>::createNode(ARGS&&... args)
+{
+    std::pmr::polymorphic_allocator<Node> allocator(&NodePoolResource::instance());
+    Node* node = allocator.allocate(1);
+
+    try
+    {
+        allocator.construct(node, std::in_place, std::forward<ARGS>(args)...);
+    }
+    catch(...)
+    {
+        allocator.deallocate(node, 1);
+        throw;
+    }
+    return node;
+}
+
+/***************************************************************************
+ * Function: destroyNode
+ * Description:
+ *      Destroys a node and gives its memory back to the node pool. Takes a
+ *      void* so the EpochDomain can call it on retired nodes.
+ * Parameters:
+ *      void* node : the node to destroy
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void ConcurrentSLL<DATA>::destroyNode(void* node)
+{
+    std::pmr::polymorphic_allocator<Node> allocator(&NodePoolResource::instance());
+    std::destroy_at(static_cast<Node*>(node));
+    allocator.deallocate(static_cast<Node*>(node), 1);
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+#endif
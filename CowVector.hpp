@@ -0,0 +1,628 @@
+/*************************************************************************************************
+* File: CowVector.hpp
+* Description:
+*       A copy-on-write Vector. Copying a CowVector doesn't copy any elements: the copies share
+*       one buffer, kept alive by an atomic reference count (std::shared_ptr). The first copy to
+*       change anything clones the buffer for itself ("detaches"), the others keep seeing the
+*       old contents. Handing out read only snapshots is therefore O(1), no matter how big the
+*       Vector is.
+*
+*       Reading never detaches, so everything that reads is const: operator[], at(), front(),
+*       data(), begin()/end() and view(), which gives the shared Vector itself for functions like
+*       the ones in Vector-SIMD.hpp. To change a single element use set(), or mutableData() to
+*       get a writable pointer to the (now unshared) buffer.
+*
+*       Threads: different CowVectors that share a buffer can be read, copied and changed from
+*       different threads at the same time. A single CowVector object is no more thread safe than
+*       an int, so don't change it while another thread copies or reads it.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the idea, refer to the following:
+*       Link: https://en.wikipedia.org/wiki/Copy-on-write
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef COW_VECTOR_H
+#define COW_VECTOR_H
+
+#include "Vector.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+#include <utility>
+#include <atomic>
+
+template<typename DATA, typename GROWTH = DoublingGrowth>
+class CowVector
+{
+    public:
+        using value_type     = DATA;
+        using const_iterator = const DATA*;
+
+        // Default Constructor
+        CowVector() = default;
+        // Takes over (or copies) an existing Vector
+        CowVector(Vector<DATA, GROWTH>&& vector);
+        CowVector(const Vector<DATA, GROWTH>& vector);
+        // Copy and move only touch the reference count
+
+        // Mutators (these clone the buffer first if it's shared)
+        void push_back(const DATA& data);
+        void push_back(DATA&& data);
+        template <typename... ARGS>
+        DATA const& emplace_back(ARGS&&... args);
+        void insertAt(size_t index, const DATA& data);
+        void erase(size_t first, size_t last);
+        void set(size_t index, const DATA& data);
+        void pop_back();
+        void clear();
+        void reserve(size_t newCapacity);
+        DATA* mutableData();
+
+        // Accessors (these never clone)
+        DATA const& front() const;
+        DATA const& back() const;
+        size_t size() const;
+        size_t capacity() const;
+        bool empty() const;
+        DATA const& operator[](size_t index) const;
+        DATA const& at(size_t index) const;
+        const DATA* data() const;
+        const_iterator begin() const;
+        const_iterator end() const;
+        const Vector<DATA, GROWTH>& view() const;
+        // True if other CowVectors share our buffer
+        bool isShared() const;
+        long useCount() const;
+
+        // Used for testing purposes
+        void displayVector() const;
+
+    private:
+        // nullptr until something is stored
+        std::shared_ptr<Vector<DATA, GROWTH>> shared_;
+
+        // Makes sure we own the buffer alone, cloning it if needed
+        Vector<DATA, GROWTH>& detach();
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS                                                                                                       */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: CowVector
+ * Description:
+ *      Moves an existing Vector into a new, unshared CowVector.
+ * Parameters:
+ *      Vector<DATA, GROWTH>&& vector : the Vector to take over
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+CowVector<DATA, GROWTH>::CowVector(Vector<DATA, GROWTH>&& vector) :
+shared_(std::make_shared<Vector<DATA, GROWTH>>(std::move(vector))) {}
+
+/***************************************************************************
+ * Function: CowVector
+ * Description:
+ *      Copies an existing Vector into a new, unshared CowVector.
+ * Parameters:
+ *      const Vector<DATA, GROWTH>& vector : the Vector to copy
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+CowVector<DATA, GROWTH>::CowVector(const Vector<DATA, GROWTH>& vector) :
+shared_(std::make_shared<Vector<DATA, GROWTH>>(vector)) {}
+
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS                                                                                                */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Pushes a copy of an element into the back of the vector.
+ * Parameters:
+ *      const DATA& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::push_back(const DATA& inputData)
+{
+    // inputData may live in the shared buffer, which the other owners could
+    // free as soon as we stop sharing it, so copy it first
+    if(isShared())
+    {
+        DATA element(inputData);
+        detach().push_back(std::move(element));
+    }
+    else
+        detach().push_back(inputData);
+}
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Moves an element into the back of the vector.
+ * Parameters:
+ *      DATA&& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::push_back(DATA&& inputData)
+{
+    detach().push_back(std::move(inputData));
+}
+
+/***************************************************************************
+ * Function: emplace_back
+ * Description:
+ *      Constructs a new element in place at the back of the vector. The
+ *      element comes back read only: a copy made later shares it, so
+ *      writing through a reference would change the copy too. Use set().
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA const& : The newly constructed element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+template <typename... ARGS>
+DATA const& CowVector<DATA, GROWTH>::emplace_back(ARGS&&... args)
+{
+    if(isShared())
+    {
+        // Same as push_back, the arguments may point into the shared buffer
+        DATA element(std::forward<ARGS>(args)...);
+        return detach().emplace_back(std::move(element));
+    }
+    return detach().emplace_back(std::forward<ARGS>(args)...);
+}
+
+/***************************************************************************
+ * Function: insertAt
+ * Description:
+ *      Inserts an element at the given index, shifting the rest back.
+ * Parameters:
+ *      size_t index          : where to insert
+ *      const DATA& inputData : The element to insert
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::insertAt(size_t index, const DATA& inputData)
+{
+    if(isShared())
+    {
+        DATA element(inputData);
+        detach().insertAt(index, std::move(element));
+    }
+    else
+        detach().insertAt(index, inputData);
+}
+
+/***************************************************************************
+ * Function: erase
+ * Description:
+ *      Removes the elements [first, last).
+ * Parameters:
+ *      size_t first : first index to remove
+ *      size_t last  : one past the last index to remove
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::erase(size_t first, size_t last)
+{
+    detach().erase(first, last);
+}
+
+/***************************************************************************
+ * Function: set
+ * Description:
+ *      Replaces the element at the given index.
+ * Parameters:
+ *      size_t index          : position of the element
+ *      const DATA& inputData : the new value
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::set(size_t index, const DATA& inputData)
+{
+    if(index >= size())
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    // Copy first, inputData may be an element of the buffer we're leaving
+    DATA value(inputData);
+    detach()[index] = std::move(value);
+}
+
+/***************************************************************************
+ * Function: pop_back
+ * Description:
+ *      Removes the last element.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::pop_back()
+{
+    if(!empty())
+        detach().pop_back();
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Removes every element. If the buffer is shared we just let go of it
+ *      instead of cloning something we'd throw away.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::clear()
+{
+    if(isShared())
+        shared_.reset();
+    else if(shared_)
+        shared_->clear();
+}
+
+/***************************************************************************
+ * Function: reserve
+ * Description:
+ *      Makes room for at least newCapacity elements in our own buffer.
+ * Parameters:
+ *      size_t newCapacity : number of elements to make room for
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::reserve(size_t newCapacity)
+{
+    detach().reserve(newCapacity);
+}
+
+/***************************************************************************
+ * Function: mutableData
+ * Description:
+ *      Returns a writable pointer to the elements, cloning them first if
+ *      they're shared. Copying this CowVector afterwards shares the buffer
+ *      again, so don't keep writing through an old pointer after a copy.
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA* : pointer to the first element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA* CowVector<DATA, GROWTH>::mutableData()
+{
+    return detach().data();
+}
+
+/*====================================================================================================================*/
+/* END OF MUTATORS                                                                                                    */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: front
+ * Description:
+ *      Returns the value at the front of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The front element in the vector
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA const& CowVector<DATA, GROWTH>::front() const
+{
+    return (*shared_)[0];
+}
+
+/***************************************************************************
+ * Function: back
+ * Description:
+ *      Returns the value at the back of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The back element in the vector
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA const& CowVector<DATA, GROWTH>::back() const
+{
+    return (*shared_)[size() - 1];
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the current size of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The size of the vector
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+size_t CowVector<DATA, GROWTH>::size() const
+{
+    return shared_ ? shared_->size() : 0;
+}
+
+/***************************************************************************
+ * Function: capacity
+ * Description:
+ *      Returns the capacity of the (possibly shared) buffer
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The capacity of the vector
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+size_t CowVector<DATA, GROWTH>::capacity() const
+{
+    return shared_ ? shared_->capacity() : 0;
+}
+
+/***************************************************************************
+ * Function: empty
+ * Description:
+ *      Returns whether or not the vector is empty
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true = vector is empty, false = vector is not empty
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+bool CowVector<DATA, GROWTH>::empty() const
+{
+    return size() == 0;
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Returns the element at the given index. The index is not checked.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA const& CowVector<DATA, GROWTH>::operator[](size_t index) const
+{
+    return (*static_cast<const Vector<DATA, GROWTH>*>(shared_.get()))[index];
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Returns the element at the given index, after checking that it's in
+ *      range.
+ * Parameters:
+ *      size_t index : position of the element
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA const& CowVector<DATA, GROWTH>::at(size_t index) const
+{
+    if(index >= size())
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return (*this)[index];
+}
+
+/***************************************************************************
+ * Function: data
+ * Description:
+ *      Returns a read only pointer to the elements.
+ * Parameters:
+ *      None
+ * Return:
+ *      const DATA* : pointer to the first element (nullptr if never used)
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+const DATA* CowVector<DATA, GROWTH>::data() const
+{
+    return shared_ ? static_cast<const Vector<DATA, GROWTH>*>(shared_.get())->data() : nullptr;
+}
+
+/***************************************************************************
+ * Function: begin
+ * Description:
+ *      Returns an iterator to the first element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename CowVector<DATA, GROWTH>::const_iterator CowVector<DATA, GROWTH>::begin() const
+{
+    return data();
+}
+
+/***************************************************************************
+ * Function: end
+ * Description:
+ *      Returns an iterator one past the last element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator past the last element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename CowVector<DATA, GROWTH>::const_iterator CowVector<DATA, GROWTH>::end() const
+{
+    return data() + size();
+}
+
+/***************************************************************************
+ * Function: view
+ * Description:
+ *      Returns the shared Vector itself, read only, so it can be passed to
+ *      anything that takes a const Vector&. Valid until this CowVector is
+ *      changed or destroyed.
+ * Parameters:
+ *      None
+ * Return:
+ *      const Vector<DATA, GROWTH>& : the elements
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+const Vector<DATA, GROWTH>& CowVector<DATA, GROWTH>::view() const
+{
+    // Function local so an empty CowVector never has to allocate
+    static const Vector<DATA, GROWTH> emptyVector;
+    return shared_ ? *shared_ : emptyVector;
+}
+
+/***************************************************************************
+ * Function: isShared
+ * Description:
+ *      Returns whether other CowVectors share our buffer. Another thread
+ *      may drop its copy right after, so treat a true as "maybe".
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true if the buffer has more than one owner
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+bool CowVector<DATA, GROWTH>::isShared() const
+{
+    return shared_.use_count() > 1;
+}
+
+/***************************************************************************
+ * Function: useCount
+ * Description:
+ *      Returns how many CowVectors share our buffer.
+ * Parameters:
+ *      None
+ * Return:
+ *      long : number of owners, 0 if there is no buffer
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+long CowVector<DATA, GROWTH>::useCount() const
+{
+    return shared_.use_count();
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: detach
+ * Description:
+ *      Makes sure nobody else sees the buffer we're about to change. If we
+ *      are the only owner, nobody can start sharing it behind our back (a
+ *      new copy has to be made from us), so no lock is needed, only an
+ *      acquire fence so the last reads of the old owners are done. Otherwise
+ *      the elements are cloned into a buffer of our own, and the other
+ *      owners keep the old one.
+ * Parameters:
+ *      None
+ * Return:
+ *      Vector<DATA, GROWTH>& : our own, unshared Vector
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>& CowVector<DATA, GROWTH>::detach()
+{
+    if(!shared_)
+        shared_ = std::make_shared<Vector<DATA, GROWTH>>();
+    else if(shared_.use_count() > 1)
+    {
+        // Built with reserve and append rather than Vector's copy
+        // constructor, which prints a trace line on every copy
+        std::shared_ptr<Vector<DATA, GROWTH>> clone = std::make_shared<Vector<DATA, GROWTH>>();
+        clone->reserve(shared_->capacity());
+        clone->append(*shared_);
+        shared_ = std::move(clone);
+    }
+    else
+    {
+        // use_count() is a relaxed load. Seeing 1 means every other owner
+        // has let go, but their reads of the buffer only happen before our
+        // writes once we pair with the release in their decrement.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    return *shared_;
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* EXTRA FUNCTIONS USED FOR TESTING/DEBUGGING                                                                         */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: displayVector
+ * Description:
+ *      Prints out the contents of the vector to the console.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void CowVector<DATA, GROWTH>::displayVector() const
+{
+    for(const DATA& element : *this)
+        std::cout << element << " ";
+
+    std::cout << std::endl;
+}
+/*====================================================================================================================*/
+/* END OF EXTRA FUNCTIONS                                                                                          */
+/*====================================================================================================================*/
+#endif //COW_VECTOR_H
@@ -0,0 +1,420 @@
+/*************************************************************************************************
+* File: Epoch-Reclamation.hpp
+* Description:
+*       Epoch based memory reclamation, for lock-free containers like ConcurrentSLL.
+*
+*       A lock-free container can't free a node as soon as it unlinks it: another thread may have
+*       read a pointer to it a moment earlier and still be looking at it. Instead the node is
+*       retired, and freed once every thread that could have seen it has moved on.
+*
+*       EpochDomain : The one process wide domain. There's a global epoch number, and every thread
+*                     that touches a container does so inside a Guard, which records the epoch it
+*                     started in. A retired node is tagged with the epoch it was retired in. The
+*                     epoch only moves forward when every thread inside a Guard has caught up
+*                     with it, so once it is two past a node's tag, nobody can still hold the
+*                     node and it is freed.
+*       Guard       : Scope of one operation. Guards nest, only the outermost one counts.
+*
+*       Retiring is cheap (an append to a thread local list); every RECLAIM_BATCH retires the
+*       thread tries to move the epoch forward and frees what it can. Whatever a thread still
+*       has pending when it finishes is handed to the domain and freed by whichever thread
+*       reclaims next. A thread that sits inside a Guard forever stops all reclamation, so keep
+*       Guards short.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17 -pthread)
+*
+*       For the idea, refer to the following:
+*       Link: https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf (Fraser, section 5.2.3)
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef EPOCH_RECLAMATION_H
+#define EPOCH_RECLAMATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+class EpochDomain
+{
+    public:
+        // Retires between attempts to reclaim
+        static constexpr size_t RECLAIM_BATCH = 128;
+
+        // The domain. It lives until the program ends.
+        static EpochDomain& instance();
+
+        class Guard
+        {
+            public:
+                Guard();
+                ~Guard();
+
+                Guard(const Guard&) = delete;
+                Guard& operator=(const Guard&) = delete;
+        };
+
+        // Hands a pointer that has just been unlinked to the domain.
+        // reclaim(pointer) is called once no thread can still be using it.
+        void retire(void* pointer, void (*reclaim)(void*));
+
+        // Tries to move the epoch forward and frees what is safe to free
+        void collect();
+
+        // The current epoch, and how many retired pointers this thread holds
+        uint64_t epoch() const;
+        size_t pending() const;
+
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator=(const EpochDomain&) = delete;
+
+    private:
+        struct Retired
+        {
+            void* pointer;
+            void (*reclaim)(void*);
+            uint64_t epoch;
+        };
+
+        // What other threads see of a thread: (epoch << 1) | inside a Guard
+        struct Record
+        {
+            std::atomic<uint64_t> state{0};
+            std::atomic<bool> inUse{false};
+            Record* next = nullptr;
+        };
+
+        // What only the thread itself sees
+        struct ThreadState
+        {
+            Record* record;
+            size_t nesting = 0;           // Guards open on this thread
+            size_t sinceCollect = 0;      // retires since the last collect()
+            std::vector<Retired> limbo;   // retired, not yet freed
+
+            ThreadState();
+            ~ThreadState();
+        };
+
+        EpochDomain() = default;
+
+        static ThreadState& threadState();
+        void enter();
+        void exit();
+        bool tryAdvance();
+        // Frees the retired pointers that are old enough
+        static void reclaimBefore(std::vector<Retired>& retired, uint64_t epoch);
+
+        std::atomic<uint64_t> epoch_{0};
+        std::atomic<Record*> records_{nullptr}; // Only ever grows, records are reused
+
+        std::mutex orphansMutex_;
+        std::vector<Retired> orphans_; // Left behind by threads that finished
+};
+
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/***************************************************************************
+ * Function: instance
+ * Description:
+ *      Returns the domain. It's never destroyed, so threads that finish
+ *      after main() returns can still hand it their pointers.
+ * Parameters:
+ *      None
+ * Return:
+ *      EpochDomain& : the domain
+***************************************************************************/
+inline EpochDomain& EpochDomain::instance()
+{
+    static EpochDomain* domain = new EpochDomain();
+    return *domain;
+}
+
+/***************************************************************************
+ * Function: Guard
+ * Description:
+ *      Starts an operation: until the Guard is destroyed, nothing retired
+ *      from now on is freed.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline EpochDomain::Guard::Guard()
+{
+    instance().enter();
+}
+
+/***************************************************************************
+ * Function: ~Guard
+ * Description:
+ *      Ends the operation.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline EpochDomain::Guard::~Guard()
+{
+    instance().exit();
+}
+
+/***************************************************************************
+ * Function: retire
+ * Description:
+ *      Queues a pointer to be reclaimed, tagged with the current epoch.
+ *      Every RECLAIM_BATCH calls it also runs collect().
+ * Parameters:
+ *      void* pointer          : the unlinked object
+ *      void (*reclaim)(void*) : frees it
+ * Return:
+ *      None
+***************************************************************************/
+inline void EpochDomain::retire(void* pointer, void (*reclaim)(void*))
+{
+    ThreadState& state = threadState();
+    state.limbo.push_back(Retired{pointer, reclaim, epoch_.load(std::memory_order_seq_cst)});
+
+    if(++state.sinceCollect >= RECLAIM_BATCH)
+        collect();
+}
+
+/***************************************************************************
+ * Function: collect
+ * Description:
+ *      Moves the epoch forward if every thread inside a Guard has caught up,
+ *      then frees this thread's retired pointers (and any left by finished
+ *      threads) that are at least two epochs old.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline void EpochDomain::collect()
+{
+    ThreadState& state = threadState();
+    state.sinceCollect = 0;
+
+    tryAdvance();
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+
+    reclaimBefore(state.limbo, epoch);
+
+    std::unique_lock<std::mutex> lock(orphansMutex_, std::try_to_lock);
+    if(lock.owns_lock() && !orphans_.empty())
+        reclaimBefore(orphans_, epoch);
+}
+
+/***************************************************************************
+ * Function: epoch
+ * Description:
+ *      Returns the global epoch.
+ * Parameters:
+ *      None
+ * Return:
+ *      uint64_t : the epoch
+***************************************************************************/
+inline uint64_t EpochDomain::epoch() const
+{
+    return epoch_.load(std::memory_order_relaxed);
+}
+
+/***************************************************************************
+ * Function: pending
+ * Description:
+ *      Returns how many retired pointers the calling thread is still
+ *      holding on to.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : count
+***************************************************************************/
+inline size_t EpochDomain::pending() const
+{
+    return threadState().limbo.size();
+}
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: ThreadState
+ * Description:
+ *      Runs the first time a thread uses the domain. Takes a free record,
+ *      or adds a new one to the domain's list.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline EpochDomain::ThreadState::ThreadState()
+{
+    EpochDomain& domain = instance();
+
+    for(record = domain.records_.load(std::memory_order_acquire); record; record = record->next)
+    {
+        bool expected = false;
+        if(!record->inUse.load(std::memory_order_relaxed) &&
+           record->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+            return;
+    }
+
+    record = new Record();
+    record->inUse.store(true, std::memory_order_relaxed);
+    record->next = domain.records_.load(std::memory_order_relaxed);
+    while(!domain.records_.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+        ;
+}
+
+/***************************************************************************
+ * Function: ~ThreadState
+ * Description:
+ *      Runs when a thread finishes. Gives its record back and hands its
+ *      pending pointers to the domain.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline EpochDomain::ThreadState::~ThreadState()
+{
+    EpochDomain& domain = instance();
+
+    if(!limbo.empty())
+    {
+        std::lock_guard<std::mutex> lock(domain.orphansMutex_);
+        domain.orphans_.insert(domain.orphans_.end(), limbo.begin(), limbo.end());
+    }
+
+    record->state.store(0, std::memory_order_release);
+    record->inUse.store(false, std::memory_order_release);
+}
+
+/***************************************************************************
+ * Function: threadState
+ * Description:
+ *      Returns the calling thread's state, creating it on first use.
+ * Parameters:
+ *      None
+ * Return:
+ *      ThreadState& : the state
+***************************************************************************/
+inline EpochDomain::ThreadState& EpochDomain::threadState()
+{
+    thread_local ThreadState state;
+    return state;
+}
+
+/***************************************************************************
+ * Function: enter
+ * Description:
+ *      Publishes that this thread is inside a Guard, and in which epoch. The
+ *      epoch is read again after publishing: if it moved in between, the
+ *      thread might have been missed by the thread that moved it, so it
+ *      publishes the new one and checks again.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline void EpochDomain::enter()
+{
+    ThreadState& state = threadState();
+    if(state.nesting++ > 0)
+        return;
+
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    while(true)
+    {
+        state.record->state.store((epoch << 1) | 1, std::memory_order_seq_cst);
+
+        uint64_t now = epoch_.load(std::memory_order_seq_cst);
+        if(now == epoch)
+            break;
+        epoch = now;
+    }
+}
+
+/***************************************************************************
+ * Function: exit
+ * Description:
+ *      Publishes that this thread has left its outermost Guard.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline void EpochDomain::exit()
+{
+    ThreadState& state = threadState();
+    if(--state.nesting > 0)
+        return;
+
+    state.record->state.store(0, std::memory_order_release);
+}
+
+/***************************************************************************
+ * Function: tryAdvance
+ * Description:
+ *      Moves the epoch forward by one if every thread inside a Guard is in
+ *      the current epoch.
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true if the epoch moved
+***************************************************************************/
+inline bool EpochDomain::tryAdvance()
+{
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+
+    for(Record* record = records_.load(std::memory_order_acquire); record; record = record->next)
+    {
+        uint64_t state = record->state.load(std::memory_order_seq_cst);
+        if((state & 1) && (state >> 1) != epoch)
+            return false;
+    }
+
+    return epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+/***************************************************************************
+ * Function: reclaimBefore
+ * Description:
+ *      Frees every retired pointer whose tag is at least two epochs behind
+ *      the given epoch, and keeps the rest.
+ * Parameters:
+ *      std::vector<Retired>& retired : the list
+ *      uint64_t epoch                : the current epoch
+ * Return:
+ *      None
+***************************************************************************/
+inline void EpochDomain::reclaimBefore(std::vector<Retired>& retired, uint64_t epoch)
+{
+    size_t kept = 0;
+    for(size_t index = 0; index < retired.size(); index++)
+    {
+        if(retired[index].epoch + 2 <= epoch)
+            retired[index].reclaim(retired[index].pointer);
+        else
+            retired[kept++] = retired[index];
+    }
+    retired.resize(kept);
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+#endif //EPOCH_RECLAMATION_H
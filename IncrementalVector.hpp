@@ -0,0 +1,649 @@
+/*************************************************************************************************
+* File: IncrementalVector.hpp
+* Description:
+*       A Vector that never copies all of its elements at once. When it's full, it allocates a
+*       buffer twice the size but keeps the old one around. Every push_back after that moves
+*       a few (STEP) of the old elements across, so by the time the new buffer is full the old
+*       one is empty and gets freed. No single push_back costs more than STEP + 1 moves, which
+*       keeps the worst case (tail) latency flat, at the price of a branch on every access.
+*
+*       Since the elements can be split over two buffers while moving, there is no data() and
+*       no iterators, use operator[] or at(). Otherwise it has the same interface as the
+*       Vector in Vector.hpp.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the idea, refer to the following:
+*       Link: https://en.wikipedia.org/wiki/Dynamic_array#Growth_factor
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef INCREMENTAL_VECTOR_H
+#define INCREMENTAL_VECTOR_H
+
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+#include <new>
+#include <utility>
+
+template<typename DATA, size_t STEP = 4>
+class IncrementalVector
+{
+    static_assert(STEP >= 1, "IncrementalVector has to move at least one element per push_back");
+
+    public:
+        // Default Constructor
+        IncrementalVector();
+        //Destructor
+        ~IncrementalVector();
+        // Copy Constructor
+        IncrementalVector(const IncrementalVector & objectToCopy);
+        // Move Constructor
+        IncrementalVector(IncrementalVector&& objectToMove) noexcept;
+        // Copy Assignment Operator
+        IncrementalVector<DATA, STEP>& operator=(const IncrementalVector &objectToCopy);
+        // Move Assignment Operator
+        IncrementalVector<DATA, STEP>& operator=(IncrementalVector&& objectToMove) noexcept;
+
+        // Mutators
+        void push_back(const DATA& data);
+        void push_back(DATA&& data);
+        template <typename... ARGS>
+        DATA& emplace_back(ARGS&&... args);
+        void pop_back();
+        void clear();
+
+        // Accessors
+        DATA const& front();
+        DATA const& back();
+        size_t const& size();
+        size_t const& capacity();
+        bool empty();
+        DATA& operator[](size_t index);
+        DATA const& operator[](size_t index) const;
+        DATA& at(size_t index);
+        // True while elements are still being moved out of the old buffer
+        bool isMigrating() const;
+        // Used for testing purposes
+        void displayVector();
+
+    private:
+        // The current buffer. Holds the elements [0, moved_) and [oldSize_, size_)
+        DATA* array_;
+        size_t capacity_;
+        size_t size_;
+
+        // The buffer we're moving away from. Holds the elements [moved_, oldSize_)
+        DATA* old_;
+        size_t oldCapacity_;
+        size_t oldSize_;
+        size_t moved_;
+
+        // Called when the current buffer is full
+        void grow();
+        // Moves up to count elements from the old buffer to the current one
+        void migrate(size_t count);
+        // Destroys every element and frees both buffers
+        void release();
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                              */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: IncrementalVector (Default Constructor)
+ * Description:
+ *      Creates an empty vector. Nothing is allocated until the first push.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+IncrementalVector<DATA, STEP>::IncrementalVector() :
+array_(nullptr), capacity_(0), size_(0), old_(nullptr), oldCapacity_(0), oldSize_(0), moved_(0) {}
+
+/***************************************************************************
+ * Function: ~IncrementalVector
+ * Description:
+ *      Destroys the elements in both buffers and frees them.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+IncrementalVector<DATA, STEP>::~IncrementalVector()
+{
+    release();
+}
+
+/***************************************************************************
+ * Function: IncrementalVector (Copy Constructor)
+ * Description:
+ *      Copies the elements of another vector into one buffer of our own.
+ * Parameters:
+ *      const IncrementalVector &objectToCopy : vector to copy from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+IncrementalVector<DATA, STEP>::IncrementalVector(const IncrementalVector &objectToCopy) : IncrementalVector()
+{
+    if(!objectToCopy.size_)
+        return;
+
+    array_    = std::allocator<DATA>().allocate(objectToCopy.size_);
+    capacity_ = objectToCopy.size_;
+
+    try
+    {
+        for(; size_ < objectToCopy.size_; size_++)
+            ::new (static_cast<void*>(array_ + size_)) DATA(objectToCopy[size_]);
+    }
+    catch(...)
+    {
+        release();
+        throw;
+    }
+
+    // Everything lives in array_, so nothing is waiting to be moved
+    oldSize_ = moved_ = size_;
+}
+
+/***************************************************************************
+ * Function: IncrementalVector (Move Constructor)
+ * Description:
+ *      Takes over both buffers of the other vector, leaving it empty.
+ * Parameters:
+ *      IncrementalVector&& objectToMove : vector to move from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+IncrementalVector<DATA, STEP>::IncrementalVector(IncrementalVector&& objectToMove) noexcept :
+array_      (std::exchange(objectToMove.array_, nullptr)),
+capacity_   (std::exchange(objectToMove.capacity_, 0)),
+size_       (std::exchange(objectToMove.size_, 0)),
+old_        (std::exchange(objectToMove.old_, nullptr)),
+oldCapacity_(std::exchange(objectToMove.oldCapacity_, 0)),
+oldSize_    (std::exchange(objectToMove.oldSize_, 0)),
+moved_      (std::exchange(objectToMove.moved_, 0)) {}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The copy assignment operator. Copies into a temporary first, so we
+ *      are left untouched if a copy throws.
+ * Parameters:
+ *      const IncrementalVector &objectToCopy : vector to copy from
+ * Return:
+ *      IncrementalVector& : this vector
+***************************************************************************/
+template <typename DATA, size_t STEP>
+IncrementalVector<DATA, STEP>& IncrementalVector<DATA, STEP>::operator=(const IncrementalVector &objectToCopy)
+{
+    if(&objectToCopy != this)
+    {
+        IncrementalVector<DATA, STEP> copy(objectToCopy);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The move assignment operator. Frees our own buffers and takes over
+ *      the other vector's.
+ * Parameters:
+ *      IncrementalVector&& objectToMove : vector to move from
+ * Return:
+ *      IncrementalVector& : this vector
+***************************************************************************/
+template <typename DATA, size_t STEP>
+IncrementalVector<DATA, STEP>& IncrementalVector<DATA, STEP>::operator=(IncrementalVector&& objectToMove) noexcept
+{
+    if(&objectToMove != this)
+    {
+        release();
+
+        array_       = std::exchange(objectToMove.array_, nullptr);
+        capacity_    = std::exchange(objectToMove.capacity_, 0);
+        size_        = std::exchange(objectToMove.size_, 0);
+        old_         = std::exchange(objectToMove.old_, nullptr);
+        oldCapacity_ = std::exchange(objectToMove.oldCapacity_, 0);
+        oldSize_     = std::exchange(objectToMove.oldSize_, 0);
+        moved_       = std::exchange(objectToMove.moved_, 0);
+    }
+    return *this;
+}
+
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                       */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Pushes a copy of an element into the back of the vector.
+ * Parameters:
+ *      const DATA& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::push_back(const DATA& inputData)
+{
+    emplace_back(inputData);
+}
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Moves an element into the back of the vector.
+ * Parameters:
+ *      DATA&& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::push_back(DATA&& inputData)
+{
+    emplace_back(std::move(inputData));
+}
+
+/***************************************************************************
+ * Function: emplace_back
+ * Description:
+ *      Constructs a new element at the back of the current buffer, then
+ *      moves up to STEP elements out of the old buffer. New elements always
+ *      go in the current buffer, so they never have to be moved again.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA, size_t STEP>
+template <typename... ARGS>
+DATA& IncrementalVector<DATA, STEP>::emplace_back(ARGS&&... args)
+{
+    if(size_ == capacity_)
+    {
+        // The arguments may point into one of our buffers, so build the
+        // element before the buffers change
+        DATA element(std::forward<ARGS>(args)...);
+        grow();
+        ::new (static_cast<void*>(array_ + size_)) DATA(std::move(element));
+    }
+    else
+    {
+        ::new (static_cast<void*>(array_ + size_)) DATA(std::forward<ARGS>(args)...);
+    }
+
+    DATA& added = array_[size_++];
+    migrate(STEP);
+    return added;
+}
+
+/***************************************************************************
+ * Function: pop_back
+ * Description:
+ *      Removes the last element, from whichever buffer it is in.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::pop_back()
+{
+    if(size_ == 0)
+        return;
+
+    size_--;
+    if(size_ >= oldSize_)
+        std::destroy_at(array_ + size_);
+    else if(size_ < moved_)
+    {
+        // Only happens once every old element has been moved
+        std::destroy_at(array_ + size_);
+        oldSize_ = moved_ = size_;
+    }
+    else
+    {
+        std::destroy_at(old_ + size_);
+        oldSize_ = size_;
+        // Frees the old buffer if that was the last element in it
+        migrate(0);
+    }
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Destroys every element. Keeps the current buffer and frees the old.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::clear()
+{
+    std::destroy(array_, array_ + moved_);
+    std::destroy(array_ + oldSize_, array_ + size_);
+    if(old_)
+    {
+        std::destroy(old_ + moved_, old_ + oldSize_);
+        std::allocator<DATA>().deallocate(old_, oldCapacity_);
+    }
+
+    old_ = nullptr;
+    oldCapacity_ = oldSize_ = moved_ = size_ = 0;
+}
+
+/*====================================================================================================================*/
+/* END OF MUTATORS                                                                                                    */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: front
+ * Description:
+ *      Returns the value at the front of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The front element in the vector
+***************************************************************************/
+template <typename DATA, size_t STEP>
+DATA const& IncrementalVector<DATA, STEP>::front()
+{
+    return (*this)[0];
+}
+
+/***************************************************************************
+ * Function: back
+ * Description:
+ *      Returns the value at the back of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The back element in the vector
+***************************************************************************/
+template <typename DATA, size_t STEP>
+DATA const& IncrementalVector<DATA, STEP>::back()
+{
+    return (*this)[size_ - 1];
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the current size of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The size of the vector
+***************************************************************************/
+template <typename DATA, size_t STEP>
+size_t const& IncrementalVector<DATA, STEP>::size()
+{
+    return size_;
+}
+
+/***************************************************************************
+ * Function: capacity
+ * Description:
+ *      Returns the capacity of the current buffer
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The capacity of the vector
+***************************************************************************/
+template <typename DATA, size_t STEP>
+size_t const& IncrementalVector<DATA, STEP>::capacity()
+{
+    return capacity_;
+}
+
+/***************************************************************************
+ * Function: empty
+ * Description:
+ *      Returns whether or not the vector is empty
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true = vector is empty, false = vector is not empty
+***************************************************************************/
+template <typename DATA, size_t STEP>
+bool IncrementalVector<DATA, STEP>::empty()
+{
+    return size_ == 0;
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Returns the element at the given index, looking in the old buffer if
+ *      it hasn't been moved yet. The index is not checked.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template <typename DATA, size_t STEP>
+DATA& IncrementalVector<DATA, STEP>::operator[](size_t index)
+{
+    return (index >= moved_ && index < oldSize_) ? old_[index] : array_[index];
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Read only version of operator[] for const vectors.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template <typename DATA, size_t STEP>
+DATA const& IncrementalVector<DATA, STEP>::operator[](size_t index) const
+{
+    return (index >= moved_ && index < oldSize_) ? old_[index] : array_[index];
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Returns the element at the given index, after checking that it's in
+ *      range.
+ * Parameters:
+ *      size_t index : position of the element
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template <typename DATA, size_t STEP>
+DATA& IncrementalVector<DATA, STEP>::at(size_t index)
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return (*this)[index];
+}
+
+/***************************************************************************
+ * Function: isMigrating
+ * Description:
+ *      Reports whether some elements are still in the old buffer.
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true while the old buffer is still alive
+***************************************************************************/
+template <typename DATA, size_t STEP>
+bool IncrementalVector<DATA, STEP>::isMigrating() const
+{
+    return old_ != nullptr;
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: grow
+ * Description:
+ *      Turns the current buffer into the old one and allocates a new one of
+ *      twice the size. Nothing is moved here. The current buffer can only
+ *      fill up after at least as many pushes as the old buffer had elements,
+ *      and each of those moves one or more, so the old buffer is always
+ *      empty by then. The check below is just a safety net.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::grow()
+{
+    if(old_)
+        migrate(oldSize_ - moved_);
+
+    size_t newCapacity = capacity_ ? capacity_ * 2 : 10;
+    DATA* newArray = std::allocator<DATA>().allocate(newCapacity);
+
+    if(size_)
+    {
+        old_         = array_;
+        oldCapacity_ = capacity_;
+        oldSize_     = size_;
+        moved_       = 0;
+    }
+    else if(array_)
+    {
+        std::allocator<DATA>().deallocate(array_, capacity_);
+    }
+
+    array_    = newArray;
+    capacity_ = newCapacity;
+}
+
+/***************************************************************************
+ * Function: migrate
+ * Description:
+ *      Moves up to count elements from the old buffer into the same slots
+ *      of the current buffer, and frees the old buffer once it's empty.
+ * Parameters:
+ *      size_t count : most elements to move
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::migrate(size_t count)
+{
+    if(!old_)
+        return;
+
+    for(; count > 0 && moved_ < oldSize_; count--, moved_++)
+    {
+        ::new (static_cast<void*>(array_ + moved_)) DATA(std::move_if_noexcept(old_[moved_]));
+        std::destroy_at(old_ + moved_);
+    }
+
+    if(moved_ == oldSize_)
+    {
+        std::allocator<DATA>().deallocate(old_, oldCapacity_);
+        old_ = nullptr;
+        oldCapacity_ = 0;
+    }
+}
+
+/***************************************************************************
+ * Function: release
+ * Description:
+ *      Destroys every element and frees both buffers.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::release()
+{
+    clear();
+    if(array_)
+        std::allocator<DATA>().deallocate(array_, capacity_);
+
+    array_ = nullptr;
+    capacity_ = 0;
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* EXTRA FUNCTIONS USED FOR TESTING/DEBUGGING                                                                         */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: displayVector
+ * Description:
+ *      Prints out the contents of the vector to the console.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t STEP>
+void IncrementalVector<DATA, STEP>::displayVector()
+{
+    for(size_t index = 0; index < size_; index++)
+        std::cout << (*this)[index] << " ";
+
+    std::cout << std::endl;
+}
+/*====================================================================================================================*/
+/* END OF EXTRA FUNCTIONS                                                                                          */
+/*====================================================================================================================*/
+#endif //INCREMENTAL_VECTOR_H
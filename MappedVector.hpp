@@ -0,0 +1,766 @@
+/*************************************************************************************************
+* File: MappedVector.hpp
+* Description:
+*       A Vector whose elements live in a file instead of on the heap. The file is mapped into
+*       memory with mmap, so the elements are read and written like a normal array, and the OS
+*       pages them in and out as needed. That means the data can be bigger than RAM, and opening
+*       an existing file makes all of its elements available right away, without reading or
+*       pushing them one by one.
+*
+*       Growing the Vector grows the file (ftruncate) and the mapping (mremap on Linux). Only
+*       trivially copyable types can be stored, since the bytes on disk are the objects.
+*
+*       File layout: a 64 byte header (magic, version, element size, element count) followed by
+*       the elements, back to back. The file also keeps any spare capacity, shrink_to_fit()
+*       trims it.
+*
+*       POSIX only. Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the system calls used, refer to the following:
+*       Link: https://man7.org/linux/man-pages/man2/mmap.2.html
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef MAPPED_VECTOR_H
+#define MAPPED_VECTOR_H
+
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Hints for the OS about how the elements are going to be read
+enum class AccessPattern { NORMAL, SEQUENTIAL, RANDOM, WILL_NEED };
+
+template<typename DATA>
+class MappedVector
+{
+    static_assert(std::is_trivially_copyable<DATA>::value, "MappedVector can only store trivially copyable types");
+    static_assert(alignof(DATA) <= 64, "MappedVector elements can't need more than 64 byte alignment");
+
+    public:
+        using value_type     = DATA;
+        using iterator       = DATA*;
+        using const_iterator = const DATA*;
+
+        // Opens the file (creating it if needed) and maps its elements
+        explicit MappedVector(const std::string& path);
+        // Unmaps and closes the file. The elements stay in the file.
+        ~MappedVector();
+        // The file can only have one owner, so no copies
+        MappedVector(const MappedVector&) = delete;
+        MappedVector<DATA>& operator=(const MappedVector&) = delete;
+        // Move Constructor
+        MappedVector(MappedVector&& objectToMove) noexcept;
+        // Move Assignment Operator
+        MappedVector<DATA>& operator=(MappedVector&& objectToMove) noexcept;
+
+        // Mutators
+        void push_back(const DATA& data);
+        template <typename... ARGS>
+        DATA& emplace_back(ARGS&&... args);
+        void pop_back();
+        void clear();
+        void reserve(size_t newCapacity);
+        void shrink_to_fit();
+        // Writes dirty pages back to the file now, instead of whenever the OS likes
+        void sync();
+        // Tells the OS how we're going to access the elements
+        void advise(AccessPattern pattern);
+
+        // Accessors
+        DATA const& front();
+        DATA const& back();
+        size_t const& size();
+        size_t const& capacity();
+        bool empty();
+        DATA& operator[](size_t index);
+        DATA const& operator[](size_t index) const;
+        DATA& at(size_t index);
+        DATA* data();
+        const DATA* data() const;
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        // Used for testing purposes
+        void displayVector();
+
+    private:
+        // Sits at the start of the file. 64 bytes, so the elements after it
+        // stay aligned.
+        struct Header
+        {
+            char     magic[8];
+            uint32_t version;
+            uint32_t elementSize;
+            uint64_t size;
+            uint64_t unused[5];
+        };
+        static_assert(sizeof(Header) == 64, "Header has to be 64 bytes");
+
+        static constexpr char MAGIC[8] = {'M', 'A', 'P', 'V', 'E', 'C', '\0', '\0'};
+        static constexpr uint32_t VERSION = 1;
+
+        int file_;          // File descriptor, -1 once moved from
+        char* mapping_;     // Start of the mapped file
+        size_t mappedBytes_;
+
+        // Used to keep track of contents
+        DATA* array_;
+        size_t capacity_;
+        size_t size_;
+
+        Header* header();
+        // Resizes the file and the mapping to fit newCapacity elements
+        void remap(size_t newCapacity);
+        // Unmaps and closes the file
+        void release();
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS, DESTRUCTOR AND MOVE ASSIGNMENT OPERATOR                                                              */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: MappedVector
+ * Description:
+ *      Opens the file at path. A new or empty file gets a fresh header. An
+ *      existing file has its header read and checked first (magic, version,
+ *      element size, and a length that is a whole number of elements), and
+ *      is then mapped as is, so its elements are there immediately. A file
+ *      that fails the checks is never written to.
+ * Parameters:
+ *      const std::string& path : file holding the elements
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+MappedVector<DATA>::MappedVector(const std::string& path) :
+file_(-1), mapping_(nullptr), mappedBytes_(0), array_(nullptr), capacity_(0), size_(0)
+{
+    file_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if(file_ < 0)
+        throw std::system_error(errno, std::generic_category(), "COULD NOT OPEN " + path);
+
+    try
+    {
+        struct stat info;
+        if(::fstat(file_, &info) < 0)
+            throw std::system_error(errno, std::generic_category(), "COULD NOT STAT " + path);
+
+        size_t fileBytes = static_cast<size_t>(info.st_size);
+        if(fileBytes == 0)
+        {
+            remap(0);
+            std::memcpy(header()->magic, MAGIC, sizeof(MAGIC));
+            header()->version     = VERSION;
+            header()->elementSize = sizeof(DATA);
+            header()->size        = 0;
+            return;
+        }
+
+        // Check the header before mapping anything: a file that isn't ours,
+        // or holds another type, must be left exactly as it is
+        Header head;
+        if(fileBytes < sizeof(Header) || ::pread(file_, &head, sizeof(Header), 0) != static_cast<ssize_t>(sizeof(Header)) ||
+           std::memcmp(head.magic, MAGIC, sizeof(MAGIC)) != 0 || head.version != VERSION)
+            throw std::runtime_error("NOT A MAPPED VECTOR FILE: " + path);
+
+        size_t capacity = (fileBytes - sizeof(Header)) / sizeof(DATA);
+        if(head.elementSize != sizeof(DATA) || (fileBytes - sizeof(Header)) % sizeof(DATA) != 0 || head.size > capacity)
+            throw std::runtime_error("FILE DOESN'T HOLD ELEMENTS OF THIS TYPE: " + path);
+
+        // Already the right size, so map it as is
+        void* mapping = ::mmap(nullptr, fileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+        if(mapping == MAP_FAILED)
+            throw std::system_error(errno, std::generic_category(), "COULD NOT MAP THE FILE");
+
+        mapping_     = static_cast<char*>(mapping);
+        mappedBytes_ = fileBytes;
+        array_       = reinterpret_cast<DATA*>(mapping_ + sizeof(Header));
+        capacity_    = capacity;
+        size_        = head.size;
+    }
+    catch(...)
+    {
+        release();
+        throw;
+    }
+}
+
+/***************************************************************************
+ * Function: ~MappedVector
+ * Description:
+ *      Unmaps and closes the file. Changes reach the file on their own since
+ *      the mapping is shared, call sync() first to wait for them.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+MappedVector<DATA>::~MappedVector()
+{
+    release();
+}
+
+/***************************************************************************
+ * Function: MappedVector (Move Constructor)
+ * Description:
+ *      Takes over the file and mapping of another MappedVector, leaving it
+ *      without a file.
+ * Parameters:
+ *      MappedVector&& objectToMove : MappedVector to move from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+MappedVector<DATA>::MappedVector(MappedVector&& objectToMove) noexcept :
+file_       (std::exchange(objectToMove.file_, -1)),
+mapping_    (std::exchange(objectToMove.mapping_, nullptr)),
+mappedBytes_(std::exchange(objectToMove.mappedBytes_, 0)),
+array_      (std::exchange(objectToMove.array_, nullptr)),
+capacity_   (std::exchange(objectToMove.capacity_, 0)),
+size_       (std::exchange(objectToMove.size_, 0)) {}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      Closes our own file and takes over the other one.
+ * Parameters:
+ *      MappedVector&& objectToMove : MappedVector to move from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+MappedVector<DATA>& MappedVector<DATA>::operator=(MappedVector&& objectToMove) noexcept
+{
+    if(&objectToMove != this)
+    {
+        release();
+
+        file_        = std::exchange(objectToMove.file_, -1);
+        mapping_     = std::exchange(objectToMove.mapping_, nullptr);
+        mappedBytes_ = std::exchange(objectToMove.mappedBytes_, 0);
+        array_       = std::exchange(objectToMove.array_, nullptr);
+        capacity_    = std::exchange(objectToMove.capacity_, 0);
+        size_        = std::exchange(objectToMove.size_, 0);
+    }
+    return *this;
+}
+
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS, DESTRUCTOR AND MOVE ASSIGNMENT OPERATOR                                                       */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* MODIFIERS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Pushes a copy of an element into the back of the vector.
+ * Parameters:
+ *      const DATA& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::push_back(const DATA& inputData)
+{
+    emplace_back(inputData);
+}
+
+/***************************************************************************
+ * Function: emplace_back
+ * Description:
+ *      Constructs a new element directly in the back of the vector. Doubles
+ *      the file when it's full.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA>
+template <typename... ARGS>
+DATA& MappedVector<DATA>::emplace_back(ARGS&&... args)
+{
+    // The arguments may point into the mapping, which can move when it grows
+    DATA element(std::forward<ARGS>(args)...);
+    if(size_ == capacity_)
+        remap(capacity_ ? capacity_ * 2 : 10);
+
+    ::new (static_cast<void*>(array_ + size_)) DATA(element);
+    header()->size = ++size_;
+    return array_[size_ - 1];
+}
+
+/***************************************************************************
+ * Function: pop_back
+ * Description:
+ *      Removes the last element. The file keeps its size.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::pop_back()
+{
+    if(size_ > 0)
+        header()->size = --size_;
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Removes every element. The file keeps its size.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::clear()
+{
+    size_ = 0;
+    if(mapping_)
+        header()->size = 0;
+}
+
+/***************************************************************************
+ * Function: reserve
+ * Description:
+ *      Grows the file so it can hold at least newCapacity elements. Does
+ *      nothing if it already can.
+ * Parameters:
+ *      size_t newCapacity : the capacity wanted
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::reserve(size_t newCapacity)
+{
+    if(newCapacity > capacity_)
+        remap(newCapacity);
+}
+
+/***************************************************************************
+ * Function: shrink_to_fit
+ * Description:
+ *      Truncates the file so it holds exactly size() elements.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::shrink_to_fit()
+{
+    if(size_ < capacity_)
+        remap(size_);
+}
+
+/***************************************************************************
+ * Function: sync
+ * Description:
+ *      Blocks until every change made so far has been written to the file.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::sync()
+{
+    if(mapping_ && ::msync(mapping_, mappedBytes_, MS_SYNC) < 0)
+        throw std::system_error(errno, std::generic_category(), "MSYNC FAILED");
+}
+
+/***************************************************************************
+ * Function: advise
+ * Description:
+ *      Passes an access pattern on to madvise. SEQUENTIAL makes the OS read
+ *      ahead aggressively, RANDOM turns read ahead off, and WILL_NEED starts
+ *      reading the whole file in right away. It's only a hint, so errors
+ *      are ignored. Applies to the current mapping, so call it again after
+ *      the vector has grown.
+ * Parameters:
+ *      AccessPattern pattern : how the elements are going to be accessed
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::advise(AccessPattern pattern)
+{
+    if(!mapping_)
+        return;
+
+    int advice = MADV_NORMAL;
+    switch(pattern)
+    {
+        case AccessPattern::NORMAL:     advice = MADV_NORMAL;     break;
+        case AccessPattern::SEQUENTIAL: advice = MADV_SEQUENTIAL; break;
+        case AccessPattern::RANDOM:     advice = MADV_RANDOM;     break;
+        case AccessPattern::WILL_NEED:  advice = MADV_WILLNEED;   break;
+    }
+    ::madvise(mapping_, mappedBytes_, advice);
+}
+
+/*====================================================================================================================*/
+/* END OF MODIFIERS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: front
+ * Description:
+ *      Returns the value at the front of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The front element in the vector
+***************************************************************************/
+template<typename DATA>
+DATA const& MappedVector<DATA>::front()
+{
+    return array_[0];
+}
+
+/***************************************************************************
+ * Function: back
+ * Description:
+ *      Returns the value at the back of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The back element in the vector
+***************************************************************************/
+template<typename DATA>
+DATA const& MappedVector<DATA>::back()
+{
+    return array_[size_ - 1];
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the current size of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The size of the vector
+***************************************************************************/
+template<typename DATA>
+size_t const& MappedVector<DATA>::size()
+{
+    return size_;
+}
+
+/***************************************************************************
+ * Function: capacity
+ * Description:
+ *      Returns how many elements fit in the file
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The capacity of the vector
+***************************************************************************/
+template<typename DATA>
+size_t const& MappedVector<DATA>::capacity()
+{
+    return capacity_;
+}
+
+/***************************************************************************
+ * Function: empty
+ * Description:
+ *      Returns whether or not the vector is empty
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true = vector is empty, false = vector is not empty
+***************************************************************************/
+template<typename DATA>
+bool MappedVector<DATA>::empty()
+{
+    return size_ == 0;
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Returns the element at the given index, without checking it.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template<typename DATA>
+DATA& MappedVector<DATA>::operator[](size_t index)
+{
+    return array_[index];
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Read only version of operator[] for const MappedVectors.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template<typename DATA>
+DATA const& MappedVector<DATA>::operator[](size_t index) const
+{
+    return array_[index];
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Returns the element at the given index, after checking that it's in
+ *      range.
+ * Parameters:
+ *      size_t index : position of the element
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template<typename DATA>
+DATA& MappedVector<DATA>::at(size_t index)
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return array_[index];
+}
+
+/***************************************************************************
+ * Function: data
+ * Description:
+ *      Returns a pointer to the first element, inside the mapping.
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA* : pointer to the first element
+***************************************************************************/
+template<typename DATA>
+DATA* MappedVector<DATA>::data()
+{
+    return array_;
+}
+
+/***************************************************************************
+ * Function: data
+ * Description:
+ *      Read only version of data() for const MappedVectors.
+ * Parameters:
+ *      None
+ * Return:
+ *      const DATA* : pointer to the first element
+***************************************************************************/
+template<typename DATA>
+const DATA* MappedVector<DATA>::data() const
+{
+    return array_;
+}
+
+/***************************************************************************
+ * Function: begin / end
+ * Description:
+ *      Iterators over the elements. Growing the vector can move the
+ *      mapping, which invalidates them.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : first element / one past the last element
+***************************************************************************/
+template<typename DATA>
+typename MappedVector<DATA>::iterator MappedVector<DATA>::begin()
+{
+    return array_;
+}
+
+template<typename DATA>
+typename MappedVector<DATA>::iterator MappedVector<DATA>::end()
+{
+    return array_ + size_;
+}
+
+template<typename DATA>
+typename MappedVector<DATA>::const_iterator MappedVector<DATA>::begin() const
+{
+    return array_;
+}
+
+template<typename DATA>
+typename MappedVector<DATA>::const_iterator MappedVector<DATA>::end() const
+{
+    return array_ + size_;
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: header
+ * Description:
+ *      Returns the header at the start of the mapping.
+ * Parameters:
+ *      None
+ * Return:
+ *      Header* : the header
+***************************************************************************/
+template <typename DATA>
+typename MappedVector<DATA>::Header* MappedVector<DATA>::header()
+{
+    return reinterpret_cast<Header*>(mapping_);
+}
+
+/***************************************************************************
+ * Function: remap
+ * Description:
+ *      Sets the file to the size needed for newCapacity elements and maps
+ *      it again. On Linux mremap can grow the mapping without copying a
+ *      single element, it just moves the page tables if it has to. Anywhere
+ *      else the file is unmapped and mapped again, which doesn't copy
+ *      anything either since the elements are in the file.
+ * Parameters:
+ *      size_t newCapacity : number of elements the file should hold
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::remap(size_t newCapacity)
+{
+    size_t newBytes = sizeof(Header) + newCapacity * sizeof(DATA);
+
+    // Grow the file before the mapping, shrink it after
+    if(newBytes > mappedBytes_ && ::ftruncate(file_, static_cast<off_t>(newBytes)) < 0)
+        throw std::system_error(errno, std::generic_category(), "COULD NOT GROW THE FILE");
+
+    void* newMapping;
+    #ifdef MREMAP_MAYMOVE
+    if(mapping_)
+        newMapping = ::mremap(mapping_, mappedBytes_, newBytes, MREMAP_MAYMOVE);
+    else
+        newMapping = ::mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+    #else
+    if(mapping_)
+        ::munmap(mapping_, mappedBytes_);
+    mapping_ = nullptr;
+    newMapping = ::mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+    #endif
+
+    if(newMapping == MAP_FAILED)
+        throw std::system_error(errno, std::generic_category(), "COULD NOT MAP THE FILE");
+
+    mapping_     = static_cast<char*>(newMapping);
+    mappedBytes_ = newBytes;
+    array_       = reinterpret_cast<DATA*>(mapping_ + sizeof(Header));
+    capacity_    = newCapacity;
+
+    if(::ftruncate(file_, static_cast<off_t>(newBytes)) < 0)
+        throw std::system_error(errno, std::generic_category(), "COULD NOT RESIZE THE FILE");
+}
+
+/***************************************************************************
+ * Function: release
+ * Description:
+ *      Unmaps and closes the file, leaving us empty.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::release()
+{
+    if(mapping_)
+        ::munmap(mapping_, mappedBytes_);
+    if(file_ >= 0)
+        ::close(file_);
+
+    file_        = -1;
+    mapping_     = nullptr;
+    mappedBytes_ = 0;
+    array_       = nullptr;
+    capacity_    = 0;
+    size_        = 0;
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* EXTRA FUNCTIONS USED FOR TESTING/DEBUGGING                                                                         */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: displayVector
+ * Description:
+ *      Prints out the contents of the vector to the console.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void MappedVector<DATA>::displayVector()
+{
+    for(size_t index = 0; index < size_; index++)
+        std::cout << array_[index] << " ";
+
+    std::cout << std::endl;
+}
+/*====================================================================================================================*/
+/* END OF EXTRA FUNCTIONS                                                                                          */
+/*====================================================================================================================*/
+#endif //MAPPED_VECTOR_H
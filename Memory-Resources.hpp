@@ -0,0 +1,1447 @@
+/*************************************************************************************************
+* File: Memory-Resources.hpp
+* Description:
+*       Memory resources that can be handed to any of the containers in this repo (Vector, SLL,
+*       both Stacks, Queue and BST all take a std::pmr::memory_resource*).
+*
+*       ArenaResource : A bump allocator. Allocating is a pointer bump, deallocating does nothing,
+*                       and release() (or the destructor) frees everything in one shot. Good for
+*                       containers that all die together, like per-request scratch data.
+*       PoolResource  : Keeps a free list per size class (8 to 512 bytes), carved out of larger
+*                       slabs. Freed blocks are reused right away, so it suits node based
+*                       containers that keep inserting and removing.
+*       AlignedResource : Hands out blocks aligned to at least a given boundary (64 bytes, a cache
+*                       line, by default), so a Vector's buffer starts on a cache line and SIMD
+*                       loads never straddle two of them.
+*       HugePageResource : Maps big blocks straight from the OS, aligned to 2 MB and marked with
+*                       madvise(MADV_HUGEPAGE), so the kernel can back them with transparent huge
+*                       pages and one TLB entry covers 2 MB instead of 4 KB. Small blocks go to
+*                       upstream. hugePageBytes() reports how much is really backed by huge pages.
+*       NodePoolResource : The one process wide pool behind every SLL (and so every Stack and Queue
+*                       built on one) that isn't given a resource of its own. Like PoolResource
+*                       it keeps free lists per size class, but every thread has its own, so
+*                       allocating and freeing nodes takes no lock and, once the pool is warm,
+*                       no malloc.
+*
+*       NodePoolResource is thread safe. None of the other resources are, use one per thread.
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the STL implementation, refer to the following:
+*       Link: https://en.cppreference.com/w/cpp/memory/memory_resource
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef MEMORY_RESOURCES_H
+#define MEMORY_RESOURCES_H
+
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <cassert>
+#include <sys/mman.h>
+
+class ArenaResource : public std::pmr::memory_resource
+{
+    public:
+        // Grab chunks from upstream, starting at initialChunkSize bytes
+        explicit ArenaResource(size_t initialChunkSize = 64 * 1024,
+                               std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        // Use the given buffer first, then fall back to upstream
+        ArenaResource(void* buffer, size_t bufferSize,
+                      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~ArenaResource();
+
+        ArenaResource(const ArenaResource&) = delete;
+        ArenaResource& operator=(const ArenaResource&) = delete;
+
+        // Frees every chunk at once. Anything allocated from the arena is gone.
+        void release();
+
+        // Statistics
+        size_t bytesAllocated() const { return bytesAllocated_; }
+        size_t allocationCount() const { return allocationCount_; }
+        size_t upstreamBytes() const { return upstreamBytes_; }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void*, size_t, size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        // Header placed at the start of every chunk we get from upstream
+        struct Chunk
+        {
+            Chunk* previous;
+            size_t size;
+        };
+
+        std::pmr::memory_resource* upstream_;
+        Chunk* chunks_;         // Most recent chunk, linked back to the older ones
+
+        char* current_;         // Next free byte
+        char* end_;             // End of the current chunk
+
+        char* initialBuffer_;   // Caller supplied buffer (not ours to free)
+        size_t initialSize_;
+
+        size_t nextChunkSize_;
+        size_t firstChunkSize_;
+
+        size_t bytesAllocated_;
+        size_t allocationCount_;
+        size_t upstreamBytes_;
+
+        void grow(size_t bytes, size_t alignment);
+};
+
+class PoolResource : public std::pmr::memory_resource
+{
+    public:
+        // Smallest and largest block size handed out of the pools. Anything
+        // bigger goes straight to upstream.
+        static constexpr size_t MIN_BLOCK = 8;
+        static constexpr size_t MAX_BLOCK = 512;
+        static constexpr size_t CLASS_COUNT = 7; // 8, 16, 32, 64, 128, 256, 512
+
+        explicit PoolResource(size_t slabSize = 64 * 1024,
+                              std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~PoolResource();
+
+        PoolResource(const PoolResource&) = delete;
+        PoolResource& operator=(const PoolResource&) = delete;
+
+        // Gives every slab back to upstream
+        void release();
+
+        // Statistics
+        size_t allocationCount() const { return allocationCount_; }
+        size_t blocksInUse() const { return blocksInUse_; }
+        size_t slabCount() const { return slabCount_; }
+        size_t oversizedCount() const { return oversizedCount_; }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        // A free block holds the link to the next free block
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // Header placed at the start of every slab
+        struct Slab
+        {
+            Slab* previous;
+            size_t size;
+            size_t alignment;
+        };
+
+        std::pmr::memory_resource* upstream_;
+        size_t slabSize_;
+        FreeBlock* freeLists_[CLASS_COUNT];
+        Slab* slabs_;
+
+        size_t allocationCount_;
+        size_t blocksInUse_;
+        size_t slabCount_;
+        size_t oversizedCount_;
+
+        static size_t sizeClass(size_t bytes, size_t alignment);
+        void refill(size_t sizeClass);
+};
+
+class AlignedResource : public std::pmr::memory_resource
+{
+    public:
+        // Every block is aligned to at least alignment bytes (a power of two)
+        explicit AlignedResource(size_t alignment = 64,
+                                 std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+        size_t alignment() const { return alignment_; }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        std::pmr::memory_resource* upstream_;
+        size_t alignment_;
+};
+
+class HugePageResource : public std::pmr::memory_resource
+{
+    public:
+        static constexpr size_t HUGE_PAGE = 2 * 1024 * 1024;
+
+        // Blocks of at least threshold bytes are mapped as huge pages, smaller
+        // ones come from upstream aligned to a cache line
+        explicit HugePageResource(size_t threshold = HUGE_PAGE,
+                                  std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~HugePageResource();
+
+        HugePageResource(const HugePageResource&) = delete;
+        HugePageResource& operator=(const HugePageResource&) = delete;
+
+        // Statistics
+        size_t mappingCount() const { return mappings_.size(); }
+        size_t mappedBytes() const { return mappedBytes_; }
+        size_t upstreamCount() const { return upstreamCount_; }
+        // How many of the mapped bytes the kernel currently backs with huge
+        // pages. Reads /proc/self/smaps, so don't call it in a hot loop.
+        size_t hugePageBytes() const;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        struct Mapping
+        {
+            void* address;
+            size_t bytes;
+        };
+
+        AlignedResource upstream_;
+        size_t threshold_;
+        std::vector<Mapping> mappings_;
+        size_t mappedBytes_;
+        size_t upstreamCount_;
+
+        static size_t roundToHugePage(size_t bytes);
+};
+
+// Counters of a NodePoolResource, see NodePoolResource::stats()
+struct NodePoolStats
+{
+    size_t allocations;   // Blocks handed out
+    size_t hits;          // ... of which came straight off a thread's free list
+    size_t deallocations; // Blocks given back
+    size_t slabs;         // Slabs carved so far (each one a single malloc)
+    size_t slabBytes;     // Bytes in those slabs
+    size_t oversized;     // Requests too big for the pool, passed to the heap
+
+    size_t blocksInUse() const { return allocations - deallocations; }
+    double hitRate() const { return allocations ? double(hits) / allocations : 0.0; }
+};
+
+class NodePoolResource : public std::pmr::memory_resource
+{
+    public:
+        static constexpr size_t MIN_BLOCK = 8;
+        static constexpr size_t MAX_BLOCK = 512;
+        static constexpr size_t CLASS_COUNT = 7; // 8, 16, 32, 64, 128, 256, 512
+        static constexpr size_t SLAB_SIZE = 64 * 1024;
+        // Blocks moved between a thread and the shared depot at a time
+        static constexpr size_t BATCH = 256;
+
+        // The pool. It lives until the program ends and its memory is never
+        // given back to the OS, only reused.
+        static NodePoolResource& instance();
+
+        // Totals over every thread, live and finished. Each thread's numbers
+        // are read without stopping it, so they may be a few operations old.
+        NodePoolStats stats() const;
+
+        // Frees count blocks of the same size in one step. The blocks are
+        // linked through their first bytes: each one starts with a pointer to
+        // the next, up to last (whose pointer is overwritten). Same as calling
+        // deallocate(p, bytes, alignment) on each of them, without the per
+        // block bookkeeping.
+        void deallocateChain(void* first, void* last, size_t count, size_t bytes, size_t alignment);
+
+        NodePoolResource(const NodePoolResource&) = delete;
+        NodePoolResource& operator=(const NodePoolResource&) = delete;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // A free list with its length
+        struct FreeList
+        {
+            FreeBlock* head = nullptr;
+            size_t count = 0;
+        };
+
+        // Counters only ever written by their own thread, so updating them
+        // needs no atomic read-modify-write, only a relaxed store
+        struct Counter
+        {
+            std::atomic<size_t> value{0};
+            void add(size_t amount = 1) { value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed); }
+            size_t get() const { return value.load(std::memory_order_relaxed); }
+        };
+
+        // Everything one thread owns
+        struct ThreadCache
+        {
+            FreeList lists[CLASS_COUNT];
+            Counter allocations;
+            Counter hits;
+            Counter deallocations;
+            ThreadCache* nextCache = nullptr;
+
+            ThreadCache();
+            ~ThreadCache();
+        };
+
+        NodePoolResource() = default;
+
+        // Set once the calling thread's cache has been destroyed. A plain bool
+        // has no destructor, so it can still be read after that.
+        static inline thread_local bool cacheGone_ = false;
+
+        // nullptr once the thread's cache is gone
+        static ThreadCache* threadCache();
+        static size_t sizeClass(size_t bytes, size_t alignment);
+        void refill(ThreadCache& cache, size_t sizeClass);
+        void carveSlab(FreeList& list, size_t sizeClass);
+        void flush(FreeList& list, size_t sizeClass, size_t count);
+        // The paths for a thread whose cache is gone, straight to the depot
+        void* allocateShared(size_t sizeClass);
+        void deallocateShared(FreeBlock* first, FreeBlock* last, size_t count, size_t sizeClass);
+
+        // Shared by every thread, guarded by mutex_
+        mutable std::mutex mutex_;
+        FreeList depot_[CLASS_COUNT];   // Blocks handed back by threads
+        ThreadCache* caches_ = nullptr; // Every live thread's cache
+        NodePoolStats retired_{};       // Counters of threads that have finished
+
+        std::atomic<size_t> slabs_{0};
+        std::atomic<size_t> oversized_{0};
+};
+
+// How many bytes of [address, address + bytes) are backed by transparent huge
+// pages right now (Linux only, 0 elsewhere). Works on any memory, e.g. v.data().
+size_t hugePageBackedBytes(const void* address, size_t bytes);
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* ARENA RESOURCE                                                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: ArenaResource
+ * Description:
+ *      Creates an empty arena. Nothing is allocated until the first request.
+ * Parameters:
+ *      size_t initialChunkSize : size of the first chunk, later ones double
+ *      std::pmr::memory_resource* upstream : where chunks come from
+ * Return:
+ *      None
+***************************************************************************/
+inline ArenaResource::ArenaResource(size_t initialChunkSize, std::pmr::memory_resource* upstream) :
+upstream_(upstream), chunks_(nullptr), current_(nullptr), end_(nullptr),
+initialBuffer_(nullptr), initialSize_(0),
+nextChunkSize_(std::max<size_t>(initialChunkSize, 256)), firstChunkSize_(nextChunkSize_),
+bytesAllocated_(0), allocationCount_(0), upstreamBytes_(0) {}
+
+/***************************************************************************
+ * Function: ArenaResource
+ * Description:
+ *      Creates an arena that hands out the given buffer first (for example a
+ *      buffer on the stack), and only goes upstream once it runs out.
+ * Parameters:
+ *      void*  buffer     : memory to use first, owned by the caller
+ *      size_t bufferSize : size of that buffer in bytes
+ *      std::pmr::memory_resource* upstream : where further chunks come from
+ * Return:
+ *      None
+***************************************************************************/
+inline ArenaResource::ArenaResource(void* buffer, size_t bufferSize, std::pmr::memory_resource* upstream) :
+ArenaResource(bufferSize, upstream)
+{
+    initialBuffer_ = static_cast<char*>(buffer);
+    initialSize_   = bufferSize;
+    current_       = initialBuffer_;
+    end_           = initialBuffer_ + bufferSize;
+}
+
+/***************************************************************************
+ * Function: ~ArenaResource
+ * Description:
+ *      Frees all the chunks.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline ArenaResource::~ArenaResource()
+{
+    release();
+}
+
+/***************************************************************************
+ * Function: release
+ * Description:
+ *      Gives every chunk back to upstream in one pass and rewinds the arena.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline void ArenaResource::release()
+{
+    while(chunks_)
+    {
+        Chunk* previous = chunks_->previous;
+        upstream_->deallocate(chunks_, chunks_->size, alignof(std::max_align_t));
+        chunks_ = previous;
+    }
+
+    current_ = initialBuffer_;
+    end_     = initialBuffer_ ? initialBuffer_ + initialSize_ : nullptr;
+
+    nextChunkSize_   = firstChunkSize_;
+    bytesAllocated_  = 0;
+    allocationCount_ = 0;
+    upstreamBytes_   = 0;
+}
+
+/***************************************************************************
+ * Function: do_allocate
+ * Description:
+ *      Bumps the current pointer, getting a new chunk if it doesn't fit.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted (a power of two)
+ * Return:
+ *      void* : the memory
+***************************************************************************/
+inline void* ArenaResource::do_allocate(size_t bytes, size_t alignment)
+{
+    void* position = current_;
+    size_t space = end_ - current_;
+
+    if(!current_ || !std::align(alignment, bytes, position, space))
+    {
+        grow(bytes, alignment);
+        position = current_;
+        space = end_ - current_;
+        std::align(alignment, bytes, position, space);
+    }
+
+    current_ = static_cast<char*>(position) + bytes;
+
+    bytesAllocated_ += bytes;
+    allocationCount_++;
+
+    return position;
+}
+
+/***************************************************************************
+ * Function: do_is_equal
+ * Description:
+ *      Memory from an arena can only go back to that same arena.
+ * Parameters:
+ *      const std::pmr::memory_resource& other : resource to compare with
+ * Return:
+ *      bool : true if they're the same object
+***************************************************************************/
+inline bool ArenaResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+/***************************************************************************
+ * Function: grow
+ * Description:
+ *      Gets a new chunk from upstream that can fit the request. Chunk sizes
+ *      double each time so the number of upstream calls stays logarithmic.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted
+ * Return:
+ *      None
+***************************************************************************/
+inline void ArenaResource::grow(size_t bytes, size_t alignment)
+{
+    size_t needed = sizeof(Chunk) + bytes + alignment;
+    size_t chunkSize = std::max(nextChunkSize_, needed);
+
+    Chunk* chunk = static_cast<Chunk*>(upstream_->allocate(chunkSize, alignof(std::max_align_t)));
+    chunk->previous = chunks_;
+    chunk->size = chunkSize;
+    chunks_ = chunk;
+
+    current_ = reinterpret_cast<char*>(chunk + 1);
+    end_     = reinterpret_cast<char*>(chunk) + chunkSize;
+
+    upstreamBytes_ += chunkSize;
+    nextChunkSize_ = chunkSize * 2;
+}
+
+/*====================================================================================================================*/
+/* END OF ARENA RESOURCE                                                                                              */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* POOL RESOURCE                                                                                                      */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: PoolResource
+ * Description:
+ *      Creates a pool with empty free lists.
+ * Parameters:
+ *      size_t slabSize : bytes requested from upstream per refill
+ *      std::pmr::memory_resource* upstream : where slabs come from
+ * Return:
+ *      None
+***************************************************************************/
+inline PoolResource::PoolResource(size_t slabSize, std::pmr::memory_resource* upstream) :
+upstream_(upstream), slabSize_(std::max(slabSize, 4 * MAX_BLOCK)), freeLists_{}, slabs_(nullptr),
+allocationCount_(0), blocksInUse_(0), slabCount_(0), oversizedCount_(0) {}
+
+/***************************************************************************
+ * Function: ~PoolResource
+ * Description:
+ *      Frees all the slabs.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline PoolResource::~PoolResource()
+{
+    release();
+}
+
+/***************************************************************************
+ * Function: release
+ * Description:
+ *      Gives every slab back to upstream and empties the free lists. Large
+ *      blocks that went straight to upstream must be freed by their owner.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline void PoolResource::release()
+{
+    while(slabs_)
+    {
+        Slab* previous = slabs_->previous;
+        upstream_->deallocate(slabs_, slabs_->size, slabs_->alignment);
+        slabs_ = previous;
+    }
+
+    std::fill(freeLists_, freeLists_ + CLASS_COUNT, nullptr);
+    blocksInUse_ = 0;
+    slabCount_   = 0;
+}
+
+/***************************************************************************
+ * Function: do_allocate
+ * Description:
+ *      Pops a block off the free list for the request's size class.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted
+ * Return:
+ *      void* : the memory
+***************************************************************************/
+inline void* PoolResource::do_allocate(size_t bytes, size_t alignment)
+{
+    allocationCount_++;
+
+    size_t index = sizeClass(bytes, alignment);
+    if(index == CLASS_COUNT)
+    {
+        oversizedCount_++;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    if(!freeLists_[index])
+        refill(index);
+
+    FreeBlock* block = freeLists_[index];
+    freeLists_[index] = block->next;
+    blocksInUse_++;
+
+    return block;
+}
+
+/***************************************************************************
+ * Function: do_deallocate
+ * Description:
+ *      Pushes the block back onto the free list of its size class.
+ * Parameters:
+ *      void*  p         : the memory
+ *      size_t bytes     : size it was allocated with
+ *      size_t alignment : alignment it was allocated with
+ * Return:
+ *      None
+***************************************************************************/
+inline void PoolResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    size_t index = sizeClass(bytes, alignment);
+    if(index == CLASS_COUNT)
+    {
+        upstream_->deallocate(p, bytes, alignment);
+        return;
+    }
+
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    block->next = freeLists_[index];
+    freeLists_[index] = block;
+    blocksInUse_--;
+}
+
+/***************************************************************************
+ * Function: do_is_equal
+ * Description:
+ *      Blocks can only go back to the pool they came from.
+ * Parameters:
+ *      const std::pmr::memory_resource& other : resource to compare with
+ * Return:
+ *      bool : true if they're the same object
+***************************************************************************/
+inline bool PoolResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+/***************************************************************************
+ * Function: sizeClass
+ * Description:
+ *      Maps a request to its size class. A block of size 2^k is always
+ *      aligned to 2^k, so the alignment just bumps the size up.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted
+ * Return:
+ *      size_t : index into freeLists_, or CLASS_COUNT if it's too big
+***************************************************************************/
+inline size_t PoolResource::sizeClass(size_t bytes, size_t alignment)
+{
+    size_t size = std::max({bytes, alignment, MIN_BLOCK});
+    if(size > MAX_BLOCK)
+        return CLASS_COUNT;
+
+    size_t index = 0;
+    for(size_t block = MIN_BLOCK; block < size; block <<= 1)
+        index++;
+
+    return index;
+}
+
+/***************************************************************************
+ * Function: refill
+ * Description:
+ *      Gets a new slab from upstream and threads all of its blocks onto the
+ *      free list of the given size class.
+ * Parameters:
+ *      size_t sizeClass : index of the free list to refill
+ * Return:
+ *      None
+***************************************************************************/
+inline void PoolResource::refill(size_t sizeClass)
+{
+    size_t blockSize = MIN_BLOCK << sizeClass;
+
+    // The header takes up the first block (or blocks, for blocks smaller
+    // than the header) so the rest stay aligned to their size
+    size_t headerSize = (sizeof(Slab) + blockSize - 1) / blockSize * blockSize;
+    size_t alignment  = std::max(blockSize, alignof(Slab));
+
+    Slab* slab = static_cast<Slab*>(upstream_->allocate(slabSize_, alignment));
+    slab->previous  = slabs_;
+    slab->size      = slabSize_;
+    slab->alignment = alignment;
+    slabs_ = slab;
+    slabCount_++;
+
+    char* first = reinterpret_cast<char*>(slab) + headerSize;
+    char* last  = reinterpret_cast<char*>(slab) + slabSize_;
+    assert(reinterpret_cast<uintptr_t>(first) % blockSize == 0);
+
+    // Thread the blocks back to front so they come out in address order
+    for(size_t count = (last - first) / blockSize; count > 0; count--)
+    {
+        FreeBlock* freeBlock = reinterpret_cast<FreeBlock*>(first + (count - 1) * blockSize);
+        freeBlock->next = freeLists_[sizeClass];
+        freeLists_[sizeClass] = freeBlock;
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF POOL RESOURCE                                                                                               */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* ALIGNED RESOURCE                                                                                                   */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: AlignedResource
+ * Description:
+ *      Creates a resource that raises every request to the given alignment.
+ * Parameters:
+ *      size_t alignment : smallest alignment handed out, a power of two
+ *      std::pmr::memory_resource* upstream : where the blocks come from
+ * Return:
+ *      None
+***************************************************************************/
+inline AlignedResource::AlignedResource(size_t alignment, std::pmr::memory_resource* upstream) :
+upstream_(upstream), alignment_(alignment)
+{
+    if(alignment == 0 || (alignment & (alignment - 1)) != 0)
+        throw std::invalid_argument("ALIGNMENT MUST BE A POWER OF TWO!");
+}
+
+/***************************************************************************
+ * Function: do_allocate
+ * Description:
+ *      Forwards to upstream with the larger of the two alignments.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted
+ * Return:
+ *      void* : the memory
+***************************************************************************/
+inline void* AlignedResource::do_allocate(size_t bytes, size_t alignment)
+{
+    return upstream_->allocate(bytes, std::max(alignment, alignment_));
+}
+
+/***************************************************************************
+ * Function: do_deallocate
+ * Description:
+ *      Gives the block back to upstream with the alignment it was made with.
+ * Parameters:
+ *      void*  p         : the memory
+ *      size_t bytes     : size it was allocated with
+ *      size_t alignment : alignment it was allocated with
+ * Return:
+ *      None
+***************************************************************************/
+inline void AlignedResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    upstream_->deallocate(p, bytes, std::max(alignment, alignment_));
+}
+
+/***************************************************************************
+ * Function: do_is_equal
+ * Description:
+ *      Two aligned resources can free each other's blocks if they use the
+ *      same alignment and the same upstream.
+ * Parameters:
+ *      const std::pmr::memory_resource& other : resource to compare with
+ * Return:
+ *      bool : true if they're interchangeable
+***************************************************************************/
+inline bool AlignedResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    const AlignedResource* aligned = dynamic_cast<const AlignedResource*>(&other);
+    return aligned && aligned->alignment_ == alignment_ && *aligned->upstream_ == *upstream_;
+}
+
+/*====================================================================================================================*/
+/* END OF ALIGNED RESOURCE                                                                                            */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* HUGE PAGE RESOURCE                                                                                                 */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: HugePageResource
+ * Description:
+ *      Creates a resource with no mappings yet.
+ * Parameters:
+ *      size_t threshold : smallest request that gets its own mapping
+ *      std::pmr::memory_resource* upstream : where smaller blocks come from
+ * Return:
+ *      None
+***************************************************************************/
+inline HugePageResource::HugePageResource(size_t threshold, std::pmr::memory_resource* upstream) :
+upstream_(64, upstream), threshold_(threshold), mappedBytes_(0), upstreamCount_(0) {}
+
+/***************************************************************************
+ * Function: ~HugePageResource
+ * Description:
+ *      Unmaps anything still mapped.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline HugePageResource::~HugePageResource()
+{
+    for(const Mapping& mapping : mappings_)
+        ::munmap(mapping.address, mapping.bytes);
+}
+
+/***************************************************************************
+ * Function: hugePageBytes
+ * Description:
+ *      Adds up how much of every live mapping is backed by huge pages.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : bytes backed by huge pages
+***************************************************************************/
+inline size_t HugePageResource::hugePageBytes() const
+{
+    size_t total = 0;
+    for(const Mapping& mapping : mappings_)
+        total += hugePageBackedBytes(mapping.address, mapping.bytes);
+
+    return total;
+}
+
+/***************************************************************************
+ * Function: do_allocate
+ * Description:
+ *      Big requests get their own anonymous mapping. It is rounded up to
+ *      whole huge pages and its start is moved to a 2 MB boundary (by
+ *      mapping one huge page too many and trimming the ends), because the
+ *      kernel can only use a huge page for a fully covered, aligned 2 MB
+ *      range. Then madvise asks for huge pages. If the kernel says no, the
+ *      memory still works, just with normal pages.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted
+ * Return:
+ *      void* : the memory
+***************************************************************************/
+inline void* HugePageResource::do_allocate(size_t bytes, size_t alignment)
+{
+    if(bytes < threshold_ || alignment > HUGE_PAGE)
+    {
+        upstreamCount_++;
+        return upstream_.allocate(bytes, alignment);
+    }
+
+    size_t size = roundToHugePage(bytes);
+    void* raw = ::mmap(nullptr, size + HUGE_PAGE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(raw == MAP_FAILED)
+        throw std::bad_alloc();
+
+    char* start = static_cast<char*>(raw);
+    char* aligned = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(start) + HUGE_PAGE - 1) & ~(HUGE_PAGE - 1));
+    if(aligned != start)
+        ::munmap(start, aligned - start);
+    if(start + HUGE_PAGE != aligned)
+        ::munmap(aligned + size, start + HUGE_PAGE - aligned);
+
+    #ifdef MADV_HUGEPAGE
+    ::madvise(aligned, size, MADV_HUGEPAGE);
+    #endif
+
+    try
+    {
+        mappings_.push_back({aligned, size});
+    }
+    catch(...)
+    {
+        ::munmap(aligned, size);
+        throw;
+    }
+    mappedBytes_ += size;
+
+    return aligned;
+}
+
+/***************************************************************************
+ * Function: do_deallocate
+ * Description:
+ *      Unmaps a big block, or hands a small one back to upstream.
+ * Parameters:
+ *      void*  p         : the memory
+ *      size_t bytes     : size it was allocated with
+ *      size_t alignment : alignment it was allocated with
+ * Return:
+ *      None
+***************************************************************************/
+inline void HugePageResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    if(bytes < threshold_ || alignment > HUGE_PAGE)
+    {
+        upstream_.deallocate(p, bytes, alignment);
+        return;
+    }
+
+    size_t size = roundToHugePage(bytes);
+    ::munmap(p, size);
+    mappedBytes_ -= size;
+
+    for(size_t index = 0; index < mappings_.size(); index++)
+    {
+        if(mappings_[index].address == p)
+        {
+            mappings_[index] = mappings_.back();
+            mappings_.pop_back();
+            break;
+        }
+    }
+}
+
+/***************************************************************************
+ * Function: do_is_equal
+ * Description:
+ *      Mappings can only go back to the resource that tracks them.
+ * Parameters:
+ *      const std::pmr::memory_resource& other : resource to compare with
+ * Return:
+ *      bool : true if they're the same object
+***************************************************************************/
+inline bool HugePageResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+/***************************************************************************
+ * Function: roundToHugePage
+ * Description:
+ *      Rounds a size up to a whole number of huge pages.
+ * Parameters:
+ *      size_t bytes : size to round
+ * Return:
+ *      size_t : the rounded size
+***************************************************************************/
+inline size_t HugePageResource::roundToHugePage(size_t bytes)
+{
+    return (bytes + HUGE_PAGE - 1) & ~(HUGE_PAGE - 1);
+}
+
+/***************************************************************************
+ * Function: hugePageBackedBytes
+ * Description:
+ *      Walks /proc/self/smaps and, for every region that overlaps the given
+ *      range, counts its AnonHugePages (capped at the overlap, since a
+ *      region can be bigger than the range).
+ * Parameters:
+ *      const void* address : start of the range
+ *      size_t bytes        : length of the range
+ * Return:
+ *      size_t : bytes backed by huge pages, 0 if it can't be told
+***************************************************************************/
+inline size_t hugePageBackedBytes(const void* address, size_t bytes)
+{
+    std::ifstream smaps("/proc/self/smaps");
+    if(!smaps)
+        return 0;
+
+    uintptr_t first = reinterpret_cast<uintptr_t>(address);
+    uintptr_t last  = first + bytes;
+
+    size_t total = 0;
+    size_t overlap = 0;
+    std::string line;
+    while(std::getline(smaps, line))
+    {
+        uintptr_t start, end;
+        char dash;
+        std::istringstream fields(line);
+
+        // Region lines look like "7f12a0000000-7f12a0400000 rw-p ..."
+        if(line.find('-') != std::string::npos && (fields >> std::hex >> start >> dash >> end) && dash == '-'
+           && line.find(':') > line.find(' '))
+        {
+            uintptr_t from = std::max(start, first);
+            uintptr_t to   = std::min(end, last);
+            overlap = from < to ? to - from : 0;
+        }
+        else if(overlap && line.compare(0, 14, "AnonHugePages:") == 0)
+        {
+            size_t kilobytes = 0;
+            std::istringstream(line.substr(14)) >> kilobytes;
+            total += std::min(kilobytes * 1024, overlap);
+        }
+    }
+
+    return total;
+}
+
+/*====================================================================================================================*/
+/* END OF HUGE PAGE RESOURCE                                                                                          */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* NODE POOL RESOURCE                                                                                                 */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: instance
+ * Description:
+ *      Returns the process wide pool. It's created on first use and on
+ *      purpose never destroyed, so a list destroyed during program exit, or
+ *      a thread finishing late, can still give its nodes back.
+ * Parameters:
+ *      None
+ * Return:
+ *      NodePoolResource& : the pool
+***************************************************************************/
+inline NodePoolResource& NodePoolResource::instance()
+{
+    static NodePoolResource* pool = new NodePoolResource();
+    return *pool;
+}
+
+/***************************************************************************
+ * Function: stats
+ * Description:
+ *      Adds up the counters of every thread that has used the pool.
+ * Parameters:
+ *      None
+ * Return:
+ *      NodePoolStats : the totals
+***************************************************************************/
+inline NodePoolStats NodePoolResource::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    NodePoolStats total = retired_;
+    for(ThreadCache* cache = caches_; cache; cache = cache->nextCache)
+    {
+        total.allocations   += cache->allocations.get();
+        total.hits          += cache->hits.get();
+        total.deallocations += cache->deallocations.get();
+    }
+
+    total.slabs     = slabs_.load(std::memory_order_relaxed);
+    total.slabBytes = total.slabs * SLAB_SIZE;
+    total.oversized = oversized_.load(std::memory_order_relaxed);
+    return total;
+}
+
+/***************************************************************************
+ * Function: ThreadCache
+ * Description:
+ *      Registers a thread's cache with the pool, so stats() can find it.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline NodePoolResource::ThreadCache::ThreadCache()
+{
+    NodePoolResource& pool = instance();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+
+    nextCache = pool.caches_;
+    pool.caches_ = this;
+}
+
+/***************************************************************************
+ * Function: ~ThreadCache
+ * Description:
+ *      Runs when a thread finishes. Hands the thread's free blocks to the
+ *      depot, where other threads pick them up, and keeps its counters.
+ *      Anything the thread allocates or frees after this goes through the
+ *      depot (see threadCache()).
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline NodePoolResource::ThreadCache::~ThreadCache()
+{
+    // Objects with static storage can still be destroyed after this, and
+    // free their nodes on this thread: those go to the depot from now on
+    cacheGone_ = true;
+
+    NodePoolResource& pool = instance();
+    for(size_t index = 0; index < CLASS_COUNT; index++)
+        pool.flush(lists[index], index, lists[index].count);
+
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+
+    ThreadCache** link = &pool.caches_;
+    while(*link != this)
+        link = &(*link)->nextCache;
+    *link = nextCache;
+
+    pool.retired_.allocations   += allocations.get();
+    pool.retired_.hits          += hits.get();
+    pool.retired_.deallocations += deallocations.get();
+}
+
+/***************************************************************************
+ * Function: do_allocate
+ * Description:
+ *      Pops a block off the calling thread's free list. Only when that is
+ *      empty does it go to the depot, and only when that's empty too is a
+ *      new slab carved.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted
+ * Return:
+ *      void* : the memory
+***************************************************************************/
+inline void* NodePoolResource::do_allocate(size_t bytes, size_t alignment)
+{
+    size_t index = sizeClass(bytes, alignment);
+    if(index == CLASS_COUNT)
+    {
+        oversized_.fetch_add(1, std::memory_order_relaxed);
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    ThreadCache* cache = threadCache();
+    if(!cache)
+        return allocateShared(index);
+
+    FreeList& list = cache->lists[index];
+
+    cache->allocations.add();
+    if(list.head)
+        cache->hits.add();
+    else
+        refill(*cache, index);
+
+    FreeBlock* block = list.head;
+    list.head = block->next;
+    list.count--;
+
+    return block;
+}
+
+/***************************************************************************
+ * Function: do_deallocate
+ * Description:
+ *      Pushes the block onto the calling thread's free list, whichever
+ *      thread allocated it. A thread that only ever frees (the consumer of a
+ *      queue) would pile up blocks, so past two batches one batch is handed
+ *      to the depot for the other threads.
+ * Parameters:
+ *      void*  p         : the memory
+ *      size_t bytes     : size it was allocated with
+ *      size_t alignment : alignment it was allocated with
+ * Return:
+ *      None
+***************************************************************************/
+inline void NodePoolResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    size_t index = sizeClass(bytes, alignment);
+    if(index == CLASS_COUNT)
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        return;
+    }
+
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    ThreadCache* cache = threadCache();
+    if(!cache)
+    {
+        deallocateShared(block, block, 1, index);
+        return;
+    }
+
+    FreeList& list = cache->lists[index];
+    block->next = list.head;
+    list.head = block;
+    list.count++;
+    cache->deallocations.add();
+
+    if(list.count > 2 * BATCH)
+        flush(list, index, BATCH);
+}
+
+/***************************************************************************
+ * Function: deallocateChain
+ * Description:
+ *      Gives back a whole chain of blocks at once. A chain that fits in the
+ *      calling thread's free list is put in front of it; a longer one goes
+ *      straight to the depot under a single lock, so freeing a huge list
+ *      costs one splice instead of a flush every BATCH blocks.
+ * Parameters:
+ *      void* first      : first block of the chain
+ *      void* last       : last block of the chain
+ *      size_t count     : number of blocks in the chain
+ *      size_t bytes     : size every block was allocated with
+ *      size_t alignment : alignment every block was allocated with
+ * Return:
+ *      None
+***************************************************************************/
+inline void NodePoolResource::deallocateChain(void* first, void* last, size_t count, size_t bytes, size_t alignment)
+{
+    if(!count)
+        return;
+
+    size_t index = sizeClass(bytes, alignment);
+    if(index == CLASS_COUNT)
+    {
+        for(FreeBlock* block = static_cast<FreeBlock*>(first); count > 0; count--)
+        {
+            FreeBlock* next = block->next;
+            std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+            block = next;
+        }
+        return;
+    }
+
+    FreeBlock* head = static_cast<FreeBlock*>(first);
+    FreeBlock* tail = static_cast<FreeBlock*>(last);
+    ThreadCache* cache = threadCache();
+    if(!cache)
+    {
+        deallocateShared(head, tail, count, index);
+        return;
+    }
+
+    cache->deallocations.add(count);
+
+    FreeList& list = cache->lists[index];
+    if(list.count + count <= 2 * BATCH)
+    {
+        tail->next = list.head;
+        list.head = head;
+        list.count += count;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeList& depot = depot_[index];
+    tail->next = depot.head;
+    depot.head = head;
+    depot.count += count;
+}
+
+/***************************************************************************
+ * Function: do_is_equal
+ * Description:
+ *      There's only one pool, so it's only equal to itself.
+ * Parameters:
+ *      const std::pmr::memory_resource& other : resource to compare with
+ * Return:
+ *      bool : true if they're the same object
+***************************************************************************/
+inline bool NodePoolResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+/***************************************************************************
+ * Function: threadCache
+ * Description:
+ *      Returns the calling thread's cache, creating it on first use. Once
+ *      the thread has finished and its cache is destroyed, returns nullptr:
+ *      lists, stacks and queues with static storage are destroyed after the
+ *      main thread's thread_locals, and must not touch a dead cache.
+ * Parameters:
+ *      None
+ * Return:
+ *      ThreadCache* : the cache, nullptr if it's gone
+***************************************************************************/
+inline NodePoolResource::ThreadCache* NodePoolResource::threadCache()
+{
+    if(cacheGone_)
+        return nullptr;
+
+    thread_local ThreadCache cache;
+    return &cache;
+}
+
+/***************************************************************************
+ * Function: sizeClass
+ * Description:
+ *      Maps a request to its size class, the same way PoolResource does.
+ * Parameters:
+ *      size_t bytes     : bytes wanted
+ *      size_t alignment : alignment wanted
+ * Return:
+ *      size_t : index of the free list, or CLASS_COUNT if it's too big
+***************************************************************************/
+inline size_t NodePoolResource::sizeClass(size_t bytes, size_t alignment)
+{
+    size_t size = std::max({bytes, alignment, MIN_BLOCK});
+    if(size > MAX_BLOCK)
+        return CLASS_COUNT;
+
+    size_t index = 0;
+    for(size_t block = MIN_BLOCK; block < size; block <<= 1)
+        index++;
+
+    return index;
+}
+
+/***************************************************************************
+ * Function: refill
+ * Description:
+ *      Fills an empty free list, with up to a batch of blocks from the depot
+ *      if it has any, otherwise with a freshly carved slab. Slabs are
+ *      aligned to their block size, so every block is aligned to its size.
+ * Parameters:
+ *      ThreadCache& cache : the calling thread's cache
+ *      size_t sizeClass   : index of the free list to refill
+ * Return:
+ *      None
+***************************************************************************/
+inline void NodePoolResource::refill(ThreadCache& cache, size_t sizeClass)
+{
+    FreeList& list = cache.lists[sizeClass];
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeList& depot = depot_[sizeClass];
+
+        for(; depot.head && list.count < BATCH; list.count++, depot.count--)
+        {
+            FreeBlock* block = depot.head;
+            depot.head = block->next;
+            block->next = list.head;
+            list.head = block;
+        }
+    }
+    if(list.head)
+        return;
+
+    carveSlab(list, sizeClass);
+}
+
+/***************************************************************************
+ * Function: carveSlab
+ * Description:
+ *      Gets a new slab and threads all of its blocks onto a free list. The
+ *      slab is aligned to the block size, so every block is aligned to its
+ *      size.
+ * Parameters:
+ *      FreeList& list   : the list to fill
+ *      size_t sizeClass : which size class it holds
+ * Return:
+ *      None
+***************************************************************************/
+inline void NodePoolResource::carveSlab(FreeList& list, size_t sizeClass)
+{
+    size_t blockSize = MIN_BLOCK << sizeClass;
+    char* slab = static_cast<char*>(::operator new(SLAB_SIZE, std::align_val_t(blockSize)));
+    slabs_.fetch_add(1, std::memory_order_relaxed);
+
+    // Thread the blocks back to front so they come out in address order
+    for(size_t count = SLAB_SIZE / blockSize; count > 0; count--)
+    {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (count - 1) * blockSize);
+        block->next = list.head;
+        list.head = block;
+        list.count++;
+    }
+}
+
+/***************************************************************************
+ * Function: flush
+ * Description:
+ *      Moves count blocks from a thread's free list to the depot.
+ * Parameters:
+ *      FreeList& list   : the thread's free list
+ *      size_t sizeClass : which size class it holds
+ *      size_t count     : how many blocks to move
+ * Return:
+ *      None
+***************************************************************************/
+inline void NodePoolResource::flush(FreeList& list, size_t sizeClass, size_t count)
+{
+    if(!count)
+        return;
+
+    // Cut the first count blocks off the list before taking the lock
+    FreeBlock* first = list.head;
+    FreeBlock* last = first;
+    for(size_t moved = 1; moved < count; moved++)
+        last = last->next;
+
+    list.head = last->next;
+    list.count -= count;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeList& depot = depot_[sizeClass];
+    last->next = depot.head;
+    depot.head = first;
+    depot.count += count;
+}
+
+/***************************************************************************
+ * Function: allocateShared
+ * Description:
+ *      Allocation for a thread whose cache is gone: takes a block from the
+ *      depot under the lock, carving a slab into it if it's empty. The
+ *      block is counted with the finished threads.
+ * Parameters:
+ *      size_t sizeClass : which size class to allocate from
+ * Return:
+ *      void* : the memory
+***************************************************************************/
+inline void* NodePoolResource::allocateShared(size_t sizeClass)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeList& depot = depot_[sizeClass];
+    if(!depot.head)
+        carveSlab(depot, sizeClass);
+
+    FreeBlock* block = depot.head;
+    depot.head = block->next;
+    depot.count--;
+    retired_.allocations++;
+
+    return block;
+}
+
+/***************************************************************************
+ * Function: deallocateShared
+ * Description:
+ *      Freeing for a thread whose cache is gone: puts a chain of blocks
+ *      straight on the depot under the lock.
+ * Parameters:
+ *      FreeBlock* first : first block of the chain
+ *      FreeBlock* last  : last block of the chain
+ *      size_t count     : number of blocks in the chain
+ *      size_t sizeClass : which size class they belong to
+ * Return:
+ *      None
+***************************************************************************/
+inline void NodePoolResource::deallocateShared(FreeBlock* first, FreeBlock* last, size_t count, size_t sizeClass)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeList& depot = depot_[sizeClass];
+    last->next = depot.head;
+    depot.head = first;
+    depot.count += count;
+    retired_.deallocations += count;
+}
+
+/*====================================================================================================================*/
+/* END OF NODE POOL RESOURCE                                                                                          */
+/*====================================================================================================================*/
+#endif //MEMORY_RESOURCES_H
@@ -0,0 +1,310 @@
+/*************************************************************************************************
+* File: Node-Index.hpp
+* Description:
+*       A side index for SLL: a hash table from element value to the node holding it, so
+*       SLL::search can answer in O(1) instead of walking the list. It's opt-in, see
+*       SLL::enableIndex().
+*
+*       NodeIndex<DATA> is the interface the list talks to. The list holds it through a pointer
+*       and only calls it when an index is enabled, so an SLL of a type without a hash still
+*       compiles. HashNodeIndex<DATA, HASH> is the implementation: open addressing with linear
+*       probing, deleting by shifting entries back instead of leaving tombstones, and kept at
+*       most half full. Each entry is the node pointer plus its element's hash (16 bytes on a
+*       64 bit machine), so with at least 2 slots per node the index costs 32 to 64 bytes per
+*       element, on top of the 16+ bytes of the node itself. bytes() reports the exact amount.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the probing scheme, refer to the following:
+*       Link: https://en.wikipedia.org/wiki/Linear_probing
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef NODE_INDEX_H
+#define NODE_INDEX_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+template <typename DATA>
+struct Node;
+
+template <typename DATA>
+class NodeIndex
+{
+    public:
+        virtual ~NodeIndex() = default;
+
+        // Adds a node that is about to be linked into the list
+        virtual void add(Node<DATA>* node) = 0;
+        // Removes a node that is about to leave the list (its element still alive)
+        virtual void remove(Node<DATA>* node) = 0;
+        // Forgets every node
+        virtual void clear() = 0;
+        // Returns a node holding element, nullptr if none. matches is set to
+        // how many nodes hold it, stopping counting at 2.
+        virtual Node<DATA>* find(const DATA& element, size_t& matches) const = 0;
+        // Memory the index uses, in bytes
+        virtual size_t bytes() const = 0;
+};
+
+template <typename DATA, typename HASH = std::hash<DATA>>
+class HashNodeIndex : public NodeIndex<DATA>
+{
+    public:
+        // Sized for expected nodes without growing
+        explicit HashNodeIndex(size_t expected = 0);
+
+        void add(Node<DATA>* node) override;
+        void remove(Node<DATA>* node) override;
+        void clear() override;
+        Node<DATA>* find(const DATA& element, size_t& matches) const override;
+        size_t bytes() const override;
+
+    private:
+        struct Slot
+        {
+            Node<DATA>* node = nullptr; // nullptr = empty
+            size_t hash = 0;
+        };
+
+        std::vector<Slot> slots_; // Always a power of two long
+        size_t shift_;            // 64 - log2(slots_.size())
+        size_t count_;            // Slots in use
+        HASH hasher_;
+
+        // The slot a hash wants to be in
+        size_t home(size_t hash) const;
+        void rehash(size_t slotCount);
+};
+
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/***************************************************************************
+ * Function: HashNodeIndex
+ * Description:
+ *      Creates an empty index with room for the given number of nodes.
+ * Parameters:
+ *      size_t expected : how many nodes it will hold to begin with
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename HASH>
+HashNodeIndex<DATA, HASH>::HashNodeIndex(size_t expected) : shift_(64), count_(0)
+{
+    size_t slotCount = 16;
+    while(slotCount < 2 * expected)
+        slotCount *= 2;
+    rehash(slotCount);
+}
+
+/***************************************************************************
+ * Function: add
+ * Description:
+ *      Puts a node in the first free slot from its element's home slot,
+ *      doubling the table first if that would make it more than half full.
+ * Parameters:
+ *      Node<DATA>* node : the node to add
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename HASH>
+void HashNodeIndex<DATA, HASH>::add(Node<DATA>* node)
+{
+    if(2 * (count_ + 1) > slots_.size())
+        rehash(2 * slots_.size());
+
+    size_t hash = hasher_(node->data);
+    size_t mask = slots_.size() - 1;
+    size_t slot = home(hash);
+    while(slots_[slot].node)
+        slot = (slot + 1) & mask;
+
+    slots_[slot].node = node;
+    slots_[slot].hash = hash;
+    count_++;
+}
+
+/***************************************************************************
+ * Function: remove
+ * Description:
+ *      Takes a node out. It's looked for by address, from its element's home
+ *      slot; if the element was changed since it was added, that misses and
+ *      the whole table is scanned instead. Entries after it in the same
+ *      cluster that would otherwise become unreachable are shifted back into
+ *      the hole, so the table never holds tombstones.
+ * Parameters:
+ *      Node<DATA>* node : the node to remove, its element must still be alive
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename HASH>
+void HashNodeIndex<DATA, HASH>::remove(Node<DATA>* node)
+{
+    size_t mask = slots_.size() - 1;
+    size_t hole = home(hasher_(node->data));
+    while(slots_[hole].node != node)
+    {
+        if(!slots_[hole].node)
+        {
+            // Not where its element's hash says: the element was changed
+            // after it was added, so look at every slot
+            hole = 0;
+            while(hole < slots_.size() && slots_[hole].node != node)
+                hole++;
+            if(hole == slots_.size())
+                return; // not in the index
+            break;
+        }
+        hole = (hole + 1) & mask;
+    }
+
+    for(size_t slot = (hole + 1) & mask; slots_[slot].node; slot = (slot + 1) & mask)
+    {
+        // An entry can move back into the hole only if its home isn't
+        // between the hole and where it is now (going around the table)
+        size_t wanted = home(slots_[slot].hash);
+        if(((slot - wanted) & mask) >= ((slot - hole) & mask))
+        {
+            slots_[hole] = slots_[slot];
+            hole = slot;
+        }
+    }
+
+    slots_[hole] = Slot{};
+    count_--;
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Empties every slot, keeping the table's size.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename HASH>
+void HashNodeIndex<DATA, HASH>::clear()
+{
+    std::fill(slots_.begin(), slots_.end(), Slot{});
+    count_ = 0;
+}
+
+/***************************************************************************
+ * Function: find
+ * Description:
+ *      Probes from the element's home slot up to the next empty slot. The
+ *      stored hashes are compared before the elements, so only real
+ *      candidates get an operator== call.
+ * Parameters:
+ *      const DATA& element : the element to look for
+ *      size_t& matches     : set to 0, 1 or 2 (meaning 2 or more)
+ * Return:
+ *      Node<DATA>* : a node holding element, nullptr if there isn't one
+***************************************************************************/
+template <typename DATA, typename HASH>
+Node<DATA>* HashNodeIndex<DATA, HASH>::find(const DATA& element, size_t& matches) const
+{
+    matches = 0;
+    Node<DATA>* found = nullptr;
+
+    size_t hash = hasher_(element);
+    size_t mask = slots_.size() - 1;
+    for(size_t slot = home(hash); slots_[slot].node; slot = (slot + 1) & mask)
+    {
+        if(slots_[slot].hash == hash && slots_[slot].node->data == element)
+        {
+            found = slots_[slot].node;
+            if(++matches == 2)
+                break;
+        }
+    }
+    return found;
+}
+
+/***************************************************************************
+ * Function: bytes
+ * Description:
+ *      Returns the memory the index uses: the table plus the object itself.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : bytes used
+***************************************************************************/
+template <typename DATA, typename HASH>
+size_t HashNodeIndex<DATA, HASH>::bytes() const
+{
+    return sizeof(*this) + slots_.capacity() * sizeof(Slot);
+}
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: home
+ * Description:
+ *      Maps a hash to a slot with Fibonacci hashing, which takes the top bits
+ *      of hash * 2^64/phi. std::hash of an integer is the integer itself, so
+ *      this keeps keys like multiples of 1024 from all landing together.
+ * Parameters:
+ *      size_t hash : the element's hash
+ * Return:
+ *      size_t : the slot
+***************************************************************************/
+template <typename DATA, typename HASH>
+size_t HashNodeIndex<DATA, HASH>::home(size_t hash) const
+{
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> shift_);
+}
+
+/***************************************************************************
+ * Function: rehash
+ * Description:
+ *      Moves every entry into a new table of the given size.
+ * Parameters:
+ *      size_t slotCount : new number of slots, a power of two
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename HASH>
+void HashNodeIndex<DATA, HASH>::rehash(size_t slotCount)
+{
+    std::vector<Slot> old(slotCount);
+    old.swap(slots_);
+
+    shift_ = 64;
+    for(size_t size = slotCount; size > 1; size /= 2)
+        shift_--;
+
+    size_t mask = slotCount - 1;
+    for(const Slot& entry : old)
+    {
+        if(!entry.node)
+            continue;
+
+        size_t slot = home(entry.hash);
+        while(slots_[slot].node)
+            slot = (slot + 1) & mask;
+        slots_[slot] = entry;
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+#endif
@@ -34,6 +34,8 @@ public:
 
     /* tell the compiler to create default constructor */
     Queue() = default; 
+    /* Container allocates from the given memory resource */
+    Queue(std::pmr::memory_resource* resource);
     /* Destructor */
     ~Queue(); 
     /* Copy Constructor */
@@ -42,13 +44,20 @@ public:
     void operator=(const Queue&);
 
     // Mutators
-    void enqueue(DATA);
+    void enqueue(const DATA&);
+    void enqueue(DATA&&);
+    template <typename... ARGS>
+    void emplace(ARGS&&...);
     void dequeue();
 
     // Accessors
     bool empty();
     size_t size();
-    DATA front();
+    DATA const& front();
+
+    // Binary save/load, see Serialization.hpp for the format
+    void save(std::ostream&) const;
+    void load(std::istream&);
 };
 
 /*====================================================================================================================*/
@@ -77,6 +86,19 @@ public:
 template <typename DATA>
 Queue<DATA>::~Queue() {}
 
+/*************************************************************************** 
+ * Function: Queue
+ * Description:
+ *      Creates an empty Queue whose container allocates from the given
+ *      memory resource.
+ * Parameters:
+ *      std::pmr::memory_resource* resource : where to allocate from
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+Queue<DATA>::Queue(std::pmr::memory_resource* resource) : container_(resource) {}
+
 /*************************************************************************** 
  * Function: Queue
  * Description:
@@ -117,16 +139,45 @@ void Queue<DATA>::operator=(const Queue& rhs){
 /*************************************************************************** 
  * Function: enqueue
  * Description:
- *      enqueue (add) the desired element to the back of the Queue
+ *      enqueue (add) a copy of the desired element to the back of the Queue
+ * Parameters:
+ *      const DATA& element : The desired element to be inserted into the queue.
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void Queue<DATA>::enqueue(const DATA& element){
+    this->emplace(element);
+}
+
+/*************************************************************************** 
+ * Function: enqueue
+ * Description:
+ *      enqueue (move) the desired element to the back of the Queue
+ * Parameters:
+ *      DATA&& element : The desired element to be inserted into the queue.
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void Queue<DATA>::enqueue(DATA&& element){
+    this->emplace(std::move(element));
+}
+
+/*************************************************************************** 
+ * Function: emplace
+ * Description:
+ *      construct a new element in place at the back of the Queue
  * Parameters:
- *      DATA element : The desired element to be inserted into the queue.
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
  * Return:
  *      None 
 ***************************************************************************/
 template <typename DATA>
-void Queue<DATA>::enqueue(DATA element){
-    if(this->empty()) { this->container_.push_front(element); return; }
-    this->container_.insert_after(element, this->size() - 1);
+template <typename... ARGS>
+void Queue<DATA>::emplace(ARGS&&... args){
+    if(this->empty()) { this->container_.emplace_front(std::forward<ARGS>(args)...); return; }
+    this->container_.emplace_after(static_cast<int>(this->size() - 1), std::forward<ARGS>(args)...);
 }
 
 /*************************************************************************** 
@@ -188,10 +239,10 @@ size_t Queue<DATA>::size(){
  * Parameters:
  *      None
  * Return:
- *      DATA : the element residing at the front of the queue. 
+ *      DATA const& : the element residing at the front of the queue. 
 ***************************************************************************/
 template <typename DATA>
-DATA Queue<DATA>::front(){
+DATA const& Queue<DATA>::front(){
     return this->container_.front();
 }
 
@@ -200,6 +251,44 @@ DATA Queue<DATA>::front(){
 /*====================================================================================================================*/
 
 
+/*====================================================================================================================*/
+/* SERIALIZATION                                                                                                      */
+/*====================================================================================================================*/
+
+/*************************************************************************** 
+ * Function: save
+ * Description:
+ *      Writes the queue to a binary stream, front first. Same format as the
+ *      underlying SLL.
+ * Parameters:
+ *      std::ostream& out : stream to write to
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void Queue<DATA>::save(std::ostream& out) const{
+    this->container_.save(out);
+}
+
+/*************************************************************************** 
+ * Function: load
+ * Description:
+ *      Replaces the contents of the queue with a queue written by save().
+ * Parameters:
+ *      std::istream& in : stream to read from
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void Queue<DATA>::load(std::istream& in){
+    this->container_.load(in);
+}
+
+/*====================================================================================================================*/
+/* END OF SERIALIZATION                                                                                               */
+/*====================================================================================================================*/
+
+
 /*====================================================================================================================*/
 /* FRIEND FUNCTIONS                                                                                                           */
 /*====================================================================================================================*/
@@ -0,0 +1,245 @@
+/*************************************************************************************************
+* File: Serialization.hpp
+* Description:
+*       The binary format used by the save()/load() functions of Vector, SLL, Queue, both Stacks
+*       and BST. Every saved container looks like this:
+*
+*           magic        4 bytes   "C131"
+*           version      2 bytes   FORMAT_VERSION
+*           container    1 byte    which container wrote it (ContainerTag)
+*           reserved     1 byte    0
+*           element size 4 bytes   sizeof(DATA) for trivially copyable elements, 0 otherwise
+*           count        8 bytes   number of elements
+*           elements     ...       count elements, see writeElement()
+*
+*       Numbers are written in the machine's own byte order, so files are meant to be read back
+*       on the same kind of machine. Trivially copyable elements are written as their raw bytes,
+*       and contiguous containers write/read all of them with a single call. std::string is
+*       written as an 8 byte length and then its characters. Any other type can be saved by
+*       adding a writeElement()/readElement() overload for it, next to the type.
+*
+*       Vector<bool> is saved as a BITMAP: count is the number of flags, followed by the 64 bit
+*       words that hold them (see Vector-Bool.hpp).
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef SERIALIZATION_H
+#define SERIALIZATION_H
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// Which container a stream was saved from
+enum class ContainerTag : uint8_t { VECTOR = 1, SLL = 2, BST = 3, BITMAP = 4 };
+
+constexpr uint16_t FORMAT_VERSION = 1;
+
+// Raw bytes in and out, throwing if the stream fails
+void writeBytes(std::ostream& out, const void* bytes, size_t count);
+void readBytes(std::istream& in, void* bytes, size_t count);
+
+// The header in front of every saved container
+template <typename DATA>
+void writeHeader(std::ostream& out, ContainerTag tag, uint64_t count);
+template <typename DATA>
+uint64_t readHeader(std::istream& in, ContainerTag tag);
+
+// One element in and out. Overload these for your own types.
+template <typename DATA>
+void writeElement(std::ostream& out, const DATA& element);
+template <typename DATA>
+void readElement(std::istream& in, DATA& element);
+void writeElement(std::ostream& out, const std::string& element);
+void readElement(std::istream& in, std::string& element);
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              FUNCTION DEFINITIONS                                                  */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: writeBytes
+ * Description:
+ *      Writes count bytes to the stream.
+ * Parameters:
+ *      std::ostream& out  : stream to write to
+ *      const void* bytes  : what to write
+ *      size_t count       : how many bytes
+ * Return:
+ *      None
+***************************************************************************/
+inline void writeBytes(std::ostream& out, const void* bytes, size_t count)
+{
+    out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+    if(!out)
+        throw std::runtime_error("COULD NOT WRITE TO THE STREAM!");
+}
+
+/***************************************************************************
+ * Function: readBytes
+ * Description:
+ *      Reads exactly count bytes from the stream.
+ * Parameters:
+ *      std::istream& in : stream to read from
+ *      void* bytes      : where to put them
+ *      size_t count     : how many bytes
+ * Return:
+ *      None
+***************************************************************************/
+inline void readBytes(std::istream& in, void* bytes, size_t count)
+{
+    in.read(static_cast<char*>(bytes), static_cast<std::streamsize>(count));
+    if(static_cast<size_t>(in.gcount()) != count)
+        throw std::runtime_error("STREAM ENDED BEFORE THE CONTAINER DID!");
+}
+
+/***************************************************************************
+ * Function: writeHeader
+ * Description:
+ *      Writes the header that goes in front of a saved container.
+ * Parameters:
+ *      std::ostream& out : stream to write to
+ *      ContainerTag tag  : which container is being saved
+ *      uint64_t count    : how many elements follow
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void writeHeader(std::ostream& out, ContainerTag tag, uint64_t count)
+{
+    char header[20] = {'C', '1', '3', '1'};
+    uint16_t version = FORMAT_VERSION;
+    uint32_t elementSize = std::is_trivially_copyable<DATA>::value ? sizeof(DATA) : 0;
+
+    std::memcpy(header + 4, &version, sizeof(version));
+    header[6] = static_cast<char>(tag);
+    std::memcpy(header + 8, &elementSize, sizeof(elementSize));
+    std::memcpy(header + 12, &count, sizeof(count));
+
+    writeBytes(out, header, sizeof(header));
+}
+
+/***************************************************************************
+ * Function: readHeader
+ * Description:
+ *      Reads and checks a header. Throws if the stream doesn't hold the
+ *      expected container, is from another version, or holds elements of a
+ *      different size.
+ * Parameters:
+ *      std::istream& in : stream to read from
+ *      ContainerTag tag : which container we're loading
+ * Return:
+ *      uint64_t : how many elements follow
+***************************************************************************/
+template <typename DATA>
+uint64_t readHeader(std::istream& in, ContainerTag tag)
+{
+    char header[20];
+    readBytes(in, header, sizeof(header));
+
+    uint16_t version;
+    uint32_t elementSize;
+    uint64_t count;
+    std::memcpy(&version, header + 4, sizeof(version));
+    std::memcpy(&elementSize, header + 8, sizeof(elementSize));
+    std::memcpy(&count, header + 12, sizeof(count));
+
+    if(std::memcmp(header, "C131", 4) != 0)
+        throw std::runtime_error("STREAM DOESN'T HOLD A SAVED CONTAINER!");
+    if(version != FORMAT_VERSION)
+        throw std::runtime_error("UNSUPPORTED FORMAT VERSION!");
+    if(header[6] != static_cast<char>(tag))
+        throw std::runtime_error("STREAM HOLDS A DIFFERENT KIND OF CONTAINER!");
+    if(elementSize != (std::is_trivially_copyable<DATA>::value ? sizeof(DATA) : 0))
+        throw std::runtime_error("STREAM HOLDS A DIFFERENT ELEMENT TYPE!");
+
+    return count;
+}
+
+/***************************************************************************
+ * Function: writeElement
+ * Description:
+ *      Writes one trivially copyable element as its raw bytes. Other types
+ *      need an overload of their own.
+ * Parameters:
+ *      std::ostream& out    : stream to write to
+ *      const DATA& element  : element to write
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void writeElement(std::ostream& out, const DATA& element)
+{
+    static_assert(std::is_trivially_copyable<DATA>::value,
+                  "Add a writeElement/readElement overload to save this type");
+    writeBytes(out, &element, sizeof(DATA));
+}
+
+/***************************************************************************
+ * Function: readElement
+ * Description:
+ *      Reads one trivially copyable element back from its raw bytes.
+ * Parameters:
+ *      std::istream& in : stream to read from
+ *      DATA& element    : where to put it
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void readElement(std::istream& in, DATA& element)
+{
+    static_assert(std::is_trivially_copyable<DATA>::value,
+                  "Add a writeElement/readElement overload to load this type");
+    readBytes(in, &element, sizeof(DATA));
+}
+
+/***************************************************************************
+ * Function: writeElement
+ * Description:
+ *      Writes a string as its length followed by its characters.
+ * Parameters:
+ *      std::ostream& out          : stream to write to
+ *      const std::string& element : string to write
+ * Return:
+ *      None
+***************************************************************************/
+inline void writeElement(std::ostream& out, const std::string& element)
+{
+    uint64_t length = element.size();
+    writeBytes(out, &length, sizeof(length));
+    writeBytes(out, element.data(), element.size());
+}
+
+/***************************************************************************
+ * Function: readElement
+ * Description:
+ *      Reads a string written by writeElement.
+ * Parameters:
+ *      std::istream& in     : stream to read from
+ *      std::string& element : where to put it
+ * Return:
+ *      None
+***************************************************************************/
+inline void readElement(std::istream& in, std::string& element)
+{
+    uint64_t length;
+    readBytes(in, &length, sizeof(length));
+
+    element.resize(length);
+    readBytes(in, &element[0], length);
+}
+
+#endif //SERIALIZATION_H
@@ -0,0 +1,52 @@
+/*************************************************************************************************
+* File: Simd-Level.hpp
+* Description:
+*       Finds out at runtime which SIMD instruction sets the CPU has, so the vectorized code in
+*       Vector-SIMD.hpp and Vector-Bool.hpp can pick the best kernel while the same binary still
+*       runs on older CPUs.
+*
+*       VECTOR_SIMD_X86 is defined when the x86 kernels can be compiled at all (g++ or clang on
+*       x86 with SSE2). AVX2_TARGET compiles a single function for AVX2, without requiring -mavx2
+*       for the whole program. Such a function may only be called once simdLevel() says AVX2.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef SIMD_LEVEL_H
+#define SIMD_LEVEL_H
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && defined(__GNUC__)
+#define VECTOR_SIMD_X86
+#include <immintrin.h>
+#define AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+// Instruction sets the kernels can use, best last
+enum class SimdLevel { SCALAR, SSE2, AVX2 };
+
+// The best instruction set the CPU we're running on supports
+SimdLevel simdLevel();
+
+/***************************************************************************
+ * Function: simdLevel
+ * Description:
+ *      Asks the CPU (through CPUID) which instruction sets it supports. This
+ *      only happens on the first call, the answer is remembered after that.
+ * Parameters:
+ *      None
+ * Return:
+ *      SimdLevel : AVX2, SSE2, or SCALAR if neither can be used
+***************************************************************************/
+inline SimdLevel simdLevel()
+{
+    #ifdef VECTOR_SIMD_X86
+    static const SimdLevel level = __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+    return level;
+    #else
+    return SimdLevel::SCALAR;
+    #endif
+}
+
+#endif //SIMD_LEVEL_H
@@ -18,6 +18,13 @@
 * Janeen Yamak      03/08/2021   Added reverse.
 * Justin Stitt      03/09/2021   Added operator=
 * Justin Stitt      04/30/2021   Added front(), back(), copy constructor
+*
+*       The nodes are linked with plain pointers and owned by the list: the list creates every
+*       node and destroys it when it's removed. There's no reference counting, so walking the
+*       list is pure pointer chasing, and a node is just the element plus one pointer. The
+*       Node<DATA>* handed out by search() is a non-owning position: it stays valid until that
+*       node is removed from the list. Unless the list is given a memory resource, the nodes
+*       come from the process wide NodePoolResource (see Memory-Resources.hpp).
 **************************************************************************************************/
 
 // INCLUDE GUARDS (You may also see, #pragma once)
@@ -27,23 +34,100 @@
 #include <memory>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
+#include <memory_resource>
+#include <iterator>
+#include <type_traits>
+#include <cstddef>
+#include "Serialization.hpp"
+#include "Memory-Resources.hpp"
+#include "Node-Index.hpp"
 
 template <typename DATA>
 struct Node
 {
     DATA data; // Element in the Node
-    std::shared_ptr<Node<DATA>> next; // Pointer to the next Node in the list
+    Node<DATA>* next; // Pointer to the next Node in the list (owned by the list, not the Node)
 
     Node() = default;
-    Node(DATA element) : data(element), next(nullptr) {}
+    Node(DATA element) : data(std::move(element)), next(nullptr) {}
+
+    // Builds the element in place out of DATA's constructor arguments
+    template <typename... ARGS>
+    Node(std::in_place_t, ARGS&&... args) : data(std::forward<ARGS>(args)...), next(nullptr) {}
+};
+
+// Forward iterator over an SLL. It can also prefetch: given a node some distance ahead, each
+// step moves that node along too and asks the CPU to start loading it, so on a list scattered
+// over memory the load is done (or under way) by the time the walk gets there.
+template <typename DATA, bool CONST>
+class SLLIterator
+{
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = DATA;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<CONST, const DATA*, DATA*>;
+        using reference         = std::conditional_t<CONST, const DATA&, DATA&>;
+
+        SLLIterator() : node_(nullptr), ahead_(nullptr) {}
+        // ahead is the node to keep prefetching from, nullptr for no prefetching
+        explicit SLLIterator(Node<DATA>* node, Node<DATA>* ahead = nullptr) : node_(node), ahead_(ahead) {}
+        // An iterator converts to a const_iterator
+        template <bool OTHER, typename = std::enable_if_t<CONST && !OTHER>>
+        SLLIterator(const SLLIterator<DATA, OTHER>& other) : node_(other.node()), ahead_(other.ahead()) {}
+
+        reference operator*() const { return node_->data; }
+        pointer operator->() const { return &node_->data; }
+
+        SLLIterator& operator++()
+        {
+            node_ = node_->next;
+            if(ahead_)
+            {
+                ahead_ = ahead_->next;
+#if defined(__GNUC__) || defined(__clang__)
+                if(ahead_)
+                    __builtin_prefetch(ahead_);
+#endif
+            }
+            return *this;
+        }
+        SLLIterator operator++(int) { SLLIterator old = *this; ++*this; return old; }
+
+        friend bool operator==(const SLLIterator& lhs, const SLLIterator& rhs) { return lhs.node_ == rhs.node_; }
+        friend bool operator!=(const SLLIterator& lhs, const SLLIterator& rhs) { return lhs.node_ != rhs.node_; }
+
+        // The node the iterator is at, to pass to insert_after, remove_after, etc.
+        Node<DATA>* node() const { return node_; }
+        Node<DATA>* ahead() const { return ahead_; }
+
+    private:
+        Node<DATA>* node_;  // Current node (the tail sentinel at the end)
+        Node<DATA>* ahead_; // Node being prefetched, nullptr if not prefetching
 };
 
 template <typename DATA>
 class SLL
 {
     public:
+        using value_type     = DATA;
+        using iterator       = SLLIterator<DATA, false>;
+        using const_iterator = SLLIterator<DATA, true>;
+
+        // A begin/end pair, so a prefetching walk works in a range-for
+        struct PrefetchedRange
+        {
+            iterator first;
+            iterator last;
+            iterator begin() const { return first; }
+            iterator end() const { return last; }
+        };
+
         // Default Constructor
         SLL();
+        // Constructor that allocates every node from the given resource
+        SLL(std::pmr::memory_resource* resource);
         // Destructor
         ~SLL();
         // Copy Constructor
@@ -52,32 +136,87 @@ class SLL
         void operator=(const SLL& objectToCopy);
 
         // Mutators
-        void push_front(DATA);
+        void push_front(const DATA&);
+        void push_front(DATA&&);
+        template <typename... ARGS>
+        DATA& emplace_front(ARGS&&...);
         void pop_front();
-        void insert_after(DATA, int); // Insert After Given an "Index"
-        void insert_after(DATA, std::shared_ptr<Node<DATA>>); // Insert After given a Pointer
+        void insert_after(const DATA&, int); // Insert After Given an "Index"
+        void insert_after(DATA&&, int);
+        void insert_after(const DATA&, Node<DATA>*); // Insert After given a Pointer
+        void insert_after(DATA&&, Node<DATA>*);
+        template <typename... ARGS>
+        DATA& emplace_after(int, ARGS&&...);
+        template <typename... ARGS>
+        DATA& emplace_after(Node<DATA>*, ARGS&&...);
         void remove();  // to-do
         void remove_after(int);
-        void remove_after(std::shared_ptr<Node<DATA>>);
+        void remove_after(Node<DATA>*);
         void clear();   
+
+        // Relinking: these move the existing nodes around and never allocate
+        void splice_after(Node<DATA>*, SLL&); // Moves all of another list after a node
+        void splice_after(Node<DATA>*, SLL&, Node<DATA>*, Node<DATA>*); // Moves the nodes strictly between two nodes
+        void merge(SLL&);   // Merges another sorted list into this sorted list
+        void sort();        // Stable, O(n log n), constant extra space
+        size_t unique();    // Removes consecutive duplicates, returns how many
         
 
         // Accessors
-        DATA front();
-        DATA back();
+        DATA const& front();
+        DATA const& back();
         size_t size();
         void print();
-        std::shared_ptr<Node<DATA>> search(DATA);
+        Node<DATA>* search(DATA);
+        // The position before the first element, for inserting or splicing at the front
+        Node<DATA>* before_begin();
+
+        // Iterators. Removing a node only invalidates iterators at that node.
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+        // An iterator that prefetches the node distance steps ahead of it
+        iterator begin(size_t prefetchDistance);
+        // for(auto& element : list.prefetched(8)) walks the list prefetching 8 nodes ahead
+        PrefetchedRange prefetched(size_t prefetchDistance);
+
+        // Opt-in hash index from element to node, making search() O(1). See Node-Index.hpp.
+        template <typename HASH = std::hash<DATA>>
+        void enableIndex();
+        void disableIndex();
+        bool indexed() const;
+        size_t indexBytes() const; // Memory the index uses, 0 when there's none
         
+        // Binary save/load, see Serialization.hpp for the format
+        void save(std::ostream& out) const;
+        void load(std::istream& in);
+
         // Fun Functions!  :)
         void reverse();
 
     private:
-        std::shared_ptr<Node<DATA>> head_; // Keep tabs on first node of the list
-        std::shared_ptr<Node<DATA>> tail_; // Keep tabs on the last node of the list
+        std::pmr::memory_resource* resource_; // Where the nodes are allocated from
+
+        Node<DATA>* head_; // Keep tabs on first node of the list
+        Node<DATA>* tail_; // Keep tabs on the last node of the list
+        Node<DATA>* last_; // The last real node (head_ if the list is empty)
+
+        std::unique_ptr<NodeIndex<DATA>> index_; // Element -> node, nullptr unless enabled
 
         // Mutators
-        void clear(std::shared_ptr<Node<DATA>>); // Helper to Clear
+        void destroyNodes(Node<DATA>*, Node<DATA>*); // Destroys a run of nodes in one go
+        void indexNode(Node<DATA>*);                  // Adds a new, unlinked node to the index
+        void indexRun(Node<DATA>*, Node<DATA>*);      // Adds a run of nodes to the index, all or none
+
+        // Sorting helpers, on runs that end in nullptr
+        static Node<DATA>* cutRun(Node<DATA>*, size_t);
+        static Node<DATA>* mergeRuns(Node<DATA>*, Node<DATA>*, Node<DATA>*);
+        template <typename... ARGS>
+        Node<DATA>* createNode(ARGS&&...); // Allocates a node from resource_
+        void destroyNode(Node<DATA>*);     // Gives a node back to resource_
 
         size_t size_; // Size of our list
 };
@@ -101,15 +240,42 @@ class SLL
 /*************************************************************************** 
  * Function: SLL
  * Description:
- *      An overloaded constructor that creates a new SLL with Sentinel Nodes
+ *      The default constructor that creates a new SLL with Sentinel Nodes,
+ *      allocated from the shared node pool (see NodePoolResource), so
+ *      pushing and popping don't call malloc once the pool is warm.
  * Parameters:
  *      None
  * Return:
  *      None 
 ***************************************************************************/
 template <typename DATA>
-SLL<DATA>::SLL() : head_(new Node<DATA>()), tail_(new Node<DATA>()), size_(0) 
+SLL<DATA>::SLL() : SLL(&NodePoolResource::instance()) {}
+
+/*************************************************************************** 
+ * Function: SLL
+ * Description:
+ *      An overloaded constructor that creates a new SLL with Sentinel Nodes.
+ *      Every node is allocated from the given memory resource, which has to
+ *      outlive the list.
+ * Parameters:
+ *      std::pmr::memory_resource* resource : where to allocate nodes from
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+SLL<DATA>::SLL(std::pmr::memory_resource* resource) : 
+resource_(resource), head_(createNode()), tail_(nullptr), last_(head_), size_(0) 
 {
+    try
+    {
+        tail_ = createNode();
+    }
+    catch(...)
+    {
+        destroyNode(head_);
+        throw;
+    }
+
     // Create an empty list (using Sentinel Nodes)
     head_->next = tail_;
 }
@@ -117,8 +283,8 @@ SLL<DATA>::SLL() : head_(new Node<DATA>()), tail_(new Node<DATA>()), size_(0)
 /*************************************************************************** 
  * Function: ~SLL
  * Description:
- *      The Destructor for the SLL, but serves little purpose as our Smart
- *      pointers will already clean up the memory!
+ *      The Destructor for the SLL. The list owns its nodes, so it destroys
+ *      every one of them, sentinels included.
  * Parameters:
  *      None
  * Return:
@@ -128,6 +294,8 @@ template <typename DATA>
 SLL<DATA>::~SLL()
 { 
     clear();
+    destroyNode(head_);
+    destroyNode(tail_);
 }
 
 
@@ -142,9 +310,9 @@ SLL<DATA>::~SLL()
  *      None 
 ***************************************************************************/
 template<typename DATA>
-SLL<DATA>::SLL(const SLL& objectToCopy)
+SLL<DATA>::SLL(const SLL& objectToCopy) : SLL()
 {
-    this = objectToCopy;
+    *this = objectToCopy;
 }
 
 /*************************************************************************** 
@@ -160,20 +328,25 @@ SLL<DATA>::SLL(const SLL& objectToCopy)
 template <typename DATA>
 void SLL<DATA>::operator=(const SLL<DATA>& rhs)
 {
+    // Copying a list onto itself would clear it first
+    if(&rhs == this)
+        return;
+
     // Empty out this linked list before copying over right-hand side list
     this->clear();
 
     // Pointer to the source and destination
-    auto src = rhs.head_, dst = this->head_;
+    Node<DATA>* src = rhs.head_;
+    Node<DATA>* dst = this->head_;
 
     for(; src->next != rhs.tail_; src = src->next, dst = dst->next, ++this->size_){
-        // copy old data
-        DATA old = src->next->data;
         // allocate new memory based off old data
-        std::shared_ptr<Node<DATA>> to_add(new Node<DATA>(old));
+        Node<DATA>* to_add = createNode(src->next->data);
+        indexNode(to_add);
         // place this new node into 'this' list
         dst->next = to_add;
         to_add->next = this->tail_;
+        this->last_ = to_add;
     }
 
 }
@@ -191,49 +364,118 @@ void SLL<DATA>::operator=(const SLL<DATA>& rhs)
 /*************************************************************************** 
  * Function: push_front
  * Description:
- *      Pushes an element into the front of the singly linked list.  
+ *      Pushes a copy of an element into the front of the singly linked list.  
+ * Parameters:
+ *      const DATA& element : The desired element to be placed into the singly linked list
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::push_front(const DATA& element)
+{
+    emplace_front(element);
+}
+
+/*************************************************************************** 
+ * Function: push_front
+ * Description:
+ *      Moves an element into the front of the singly linked list.  
  * Parameters:
- *      DATA element : The desired element to be placed into the singly linked list
+ *      DATA&& element : The desired element to be placed into the singly linked list
  * Return:
  *      None 
 ***************************************************************************/
 template <typename DATA>
-void SLL<DATA>::push_front(DATA element)
+void SLL<DATA>::push_front(DATA&& element)
+{
+    emplace_front(std::move(element));
+}
+
+/*************************************************************************** 
+ * Function: emplace_front
+ * Description:
+ *      Constructs a new element directly inside a new node at the front of
+ *      the singly linked list.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA>
+template <typename... ARGS>
+DATA& SLL<DATA>::emplace_front(ARGS&&... args)
 {
     // Dynamically create the new node
-    std::shared_ptr<Node<DATA>> to_add(new Node<DATA> (element));
+    Node<DATA>* to_add = createNode(std::forward<ARGS>(args)...);
+    indexNode(to_add);
 
     // Reassign 'to_add's next ptr to point to head
     to_add->next = head_->next;
     
     // Redefine head as our new node
     head_->next = to_add;
+
+    // The first node of an empty list is also the last
+    if(last_ == head_)
+        last_ = to_add;
     
     size_++;// increment size
+
+    return to_add->data;
+}
+
+/*************************************************************************** 
+ * Function: insert_after
+ * Description:
+ *      Inserts a copy of an element after the given index.  
+ * Parameters:
+ *      const DATA& d   : The desired element to be placed into the singly linked list
+ *      int         idx : The index to insert after. (0 : size_-1)
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::insert_after(const DATA& d, int idx)
+{
+    emplace_after(idx, d);
 }
 
 /*************************************************************************** 
  * Function: insert_after
  * Description:
- *      Pushes an element into the front of the singly linked list.  
+ *      Moves an element into the list after the given index.  
  * Parameters:
- *      DATA d  : The desired element to be placed into the singly linked list
- *      int idx : The index to insert after. (0 : size_-1)
+ *      DATA&& d   : The desired element to be placed into the singly linked list
+ *      int    idx : The index to insert after. (0 : size_-1)
  * Return:
  *      None 
 ***************************************************************************/
 template <typename DATA>
-void SLL<DATA>::insert_after(DATA d, int idx)
+void SLL<DATA>::insert_after(DATA&& d, int idx)
+{
+    emplace_after(idx, std::move(d));
+}
+
+/*************************************************************************** 
+ * Function: emplace_after
+ * Description:
+ *      Constructs a new element in place after the given index.  
+ * Parameters:
+ *      int       idx  : The index to insert after. (0 : size_-1)
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA>
+template <typename... ARGS>
+DATA& SLL<DATA>::emplace_after(int idx, ARGS&&... args)
 {
     if(idx < 0 || idx > static_cast<int>(this->size_-1)){
         throw std::out_of_range("ERROR: index out of bounds!");
     }
 
-    // Node we want to add
-    std::shared_ptr<Node<DATA>> to_add = std::make_shared<Node<DATA>>(d);
-
     // temp pointer used for iteration. Begins at first node.
-    std::shared_ptr<Node<DATA>> tmp(head_->next);
+    Node<DATA>* tmp = head_->next;
 
     // Step through the SLL 'idx' times
     while(idx > 0)
@@ -242,61 +484,114 @@ void SLL<DATA>::insert_after(DATA d, int idx)
         idx--;
     }
 
+    // Node we want to add
+    Node<DATA>* to_add = createNode(std::forward<ARGS>(args)...);
+    indexNode(to_add);
+
     // rearrange pointers
     to_add->next = tmp->next;
     tmp->next = to_add;
+    if(tmp == last_)
+        last_ = to_add;
 
     // increment size
     size_++;
+
+    return to_add->data;
 }
 
 /*************************************************************************** 
  * Function: insert_after
  * Description:
- *      Inserts an element into a list after a given node within the list.  
+ *      Inserts a copy of an element into a list after a given node within the list.  
  * Parameters:
- *      DATA inputData : The desired element to be placed into the singly linked list
- *      std::shared_ptr<Node<DATA>> position   : The index to insert after.
+ *      const DATA& element : The desired element to be placed into the singly linked list
+ *      Node<DATA>* position : The node to insert after.
  * Return:  
  *      None 
 ***************************************************************************/
 template <typename DATA>
-void SLL<DATA>::insert_after(DATA element, std::shared_ptr<Node<DATA>> position)
+void SLL<DATA>::insert_after(const DATA& element, Node<DATA>* position)
+{
+    emplace_after(position, element);
+}
+
+/*************************************************************************** 
+ * Function: insert_after
+ * Description:
+ *      Moves an element into a list after a given node within the list.  
+ * Parameters:
+ *      DATA&& element : The desired element to be placed into the singly linked list
+ *      Node<DATA>* position : The node to insert after.
+ * Return:  
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::insert_after(DATA&& element, Node<DATA>* position)
+{
+    emplace_after(position, std::move(element));
+}
+
+/*************************************************************************** 
+ * Function: emplace_after
+ * Description:
+ *      Constructs a new element in place after a given node within the list.  
+ * Parameters:
+ *      Node<DATA>* position : The node to insert after.
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:  
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA>
+template <typename... ARGS>
+DATA& SLL<DATA>::emplace_after(Node<DATA>* position, ARGS&&... args)
 {
     // Bounds checking! Make sure the 
     if(!position || position == this->tail_)
         throw std::out_of_range("INVALID POSITION GIVEN!");
 
     // Encapsualte the ele into a Node
-    std::shared_ptr<Node<DATA>> nodeToInsert(new Node<DATA>(element)); 
+    Node<DATA>* nodeToInsert = createNode(std::forward<ARGS>(args)...); 
+    indexNode(nodeToInsert);
 
     // Attach our new node to hold onto the list, before we detach 'position'
     nodeToInsert->next = position->next;
 
     // Have 'position' point to the new Node
     position->next = nodeToInsert;
+    if(position == last_)
+        last_ = nodeToInsert;
 
     // Update the Size of our linked list
     size_++; 
+
+    return nodeToInsert->data;
 }
 
 /*************************************************************************** 
  * Function: remove_after
  * Description:
- *      Removes in a list at a given place within the list.  
+ *      Removes the node after a given node within the list.  
  * Parameters:
- *      DATA inputData : The desired element to be placed into the singly linked list
- *      std::shared_ptr<Node<DATA>> position   : The index to insert after. (0:size_-1)
+ *      Node<DATA>* position : The node before the one to remove.
  * Return:  
  *      None 
 ***************************************************************************/
 template <typename DATA>
-void SLL<DATA>::remove_after(std::shared_ptr<Node<DATA>> position)
+void SLL<DATA>::remove_after(Node<DATA>* position)
 {
-    if(position == head_ || position == tail_ || !position)
+    if(position == head_ || position == tail_ || !position || position->next == tail_)
         return;
 
-    position->next = position->next->next;
+    Node<DATA>* removed = position->next;
+    position->next = removed->next;
+    if(removed == last_)
+        last_ = position;
+
+    if(index_)
+        index_->remove(removed);
+    destroyNode(removed);
+    size_--;
 }
 
 
@@ -315,16 +610,21 @@ void SLL<DATA>::pop_front()
     // cannot remove from an empty list!
     if(size_ <= 0) return;
 
-    // progress head pointer to its neighbour, use reset to remove old head
-    head_->next = head_->next->next;
+    // progress head pointer to its neighbour
+    Node<DATA>* removed = head_->next;
+    head_->next = removed->next;
 
     /*
-        Notice here that although the 'old' head has zero pointers pointing to it
-        smart pointers recognize this and will relinquish the memory. -- Yay, no leaks!
-        (btw, this is what makes smart pointers 'smart')
+        Nothing else points at the old first node now, and the list owns it,
+        so it's the list's job to give the memory back.
     */
+    if(index_)
+        index_->remove(removed);
+    destroyNode(removed);
 
    size_--; // lastly, decrement size
+   if(size_ == 0)
+       last_ = head_;
 }
 
 /*************************************************************************** 
@@ -343,8 +643,8 @@ void SLL<DATA>::remove_after(int idx)
         throw std::out_of_range("ERROR: index out of bounds!");
 
 
-    // temp pointer used for iteration
-    std::shared_ptr<Node<DATA>> tmp(head_);
+    // temp pointer used for iteration. Begins at first node.
+    Node<DATA>* tmp = head_->next;
 
     // iterate through the SLL 'idx' times
     while(idx > 0)
@@ -354,7 +654,13 @@ void SLL<DATA>::remove_after(int idx)
     }
     
     // jump past tmp's neighbour, effectively removing it
-    tmp->next = tmp->next->next; // note that next->next may be null here (if idx == size_-1)
+    Node<DATA>* removed = tmp->next;
+    tmp->next = removed->next;
+    if(removed == last_)
+        last_ = tmp;
+    if(index_)
+        index_->remove(removed);
+    destroyNode(removed);
     
     --this->size_;// decrement size
 }
@@ -363,7 +669,7 @@ void SLL<DATA>::remove_after(int idx)
  * Function: clear
  * Description:
  *      Removes all the nodes within a linked list, leaving only the sentinel 
- *          nodes. This is the user facing wrapper.
+ *          nodes. Uses constant stack space however long the list is.
  * Parameters:
  *      None
  * Return:
@@ -372,43 +678,232 @@ void SLL<DATA>::remove_after(int idx)
 template <typename DATA>
 void SLL<DATA>::clear()
 {
-    // Pass in the first Node in the list
-    clear(head_->next); 
+    // Everything between the sentinels goes
+    if(index_)
+        index_->clear();
+    destroyNodes(head_->next, tail_);
 
-    /*
-    *  Note! We could also have iteratively used pop_front to clear!
-    *  We implemented this way to get some good ol' recursion practice in. 
-    */
+    head_->next = tail_;
+    last_ = head_;
+    size_ = 0;
 }
 
 /*************************************************************************** 
- * Function: clear
+ * Function: destroyNodes
  * Description:
- *      Removes all the nodes within a linked list, leaving only the sentinel 
- *          nodes. 
+ *      Destroys the nodes from first up to (not including) stop, in a loop
+ *      so any length of list is fine. Every node's memory is threaded into
+ *      a chain as its element is destroyed; if the nodes came from the node
+ *      pool, the whole chain goes back to it in one step. The caller has to
+ *      unlink the run and fix size_.
  * Parameters:
- *      std::shared_ptr<Node<DATA>> position : the node in which to begin removal.
+ *      Node<DATA>* first : the first node to destroy
+ *      Node<DATA>* stop  : the node after the last one to destroy
  * Return:
  *      None 
 ***************************************************************************/
 template <typename DATA>
-void SLL<DATA>::clear(std::shared_ptr<Node<DATA>> position)
+void SLL<DATA>::destroyNodes(Node<DATA>* first, Node<DATA>* stop)
 {
-    // Base Case: Check to see if list is empty or at the end of the list
-    if (position == tail_ || size_ == 0)
+    if(first == stop)
         return;
-    
-    // Recursive call, till we get to the last node
-    clear(position->next);
 
-    /*
-    * Break the chain to the node we're pointing at. The Smart pointers will
-    * clean up the allocated memory and wipe the node. 
-    */
-    position->next = nullptr;
+    if(resource_ != &NodePoolResource::instance())
+    {
+        while(first != stop)
+        {
+            Node<DATA>* next = first->next;
+            destroyNode(first);
+            first = next;
+        }
+        return;
+    }
 
-    // Update the size;
-    size_--;
+    // Each dead node's first bytes point at the next dead node
+    void* chain = first;
+    void* last = first;
+    size_t count = 0;
+    for(Node<DATA>* node = first; node != stop; count++)
+    {
+        Node<DATA>* next = node->next;
+        std::destroy_at(node);
+
+        *static_cast<void**>(last) = node;
+        last = node;
+        node = next;
+    }
+
+    NodePoolResource::instance().deallocateChain(chain, last, count, sizeof(Node<DATA>), alignof(Node<DATA>));
+}
+
+/*************************************************************************** 
+ * Function: indexNode
+ * Description:
+ *      Adds a node to the index, if there is one. Called before the node is
+ *      linked in: if adding throws, the node is destroyed and the list and
+ *      index are left as they were.
+ * Parameters:
+ *      Node<DATA>* node : the new node, not linked yet
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::indexNode(Node<DATA>* node)
+{
+    if(!index_)
+        return;
+
+    try
+    {
+        index_->add(node);
+    }
+    catch(...)
+    {
+        destroyNode(node);
+        throw;
+    }
+}
+
+/*************************************************************************** 
+ * Function: indexRun
+ * Description:
+ *      Adds the nodes from first up to (not including) stop to the index, if
+ *      there is one. If an add throws, the ones already added are taken out
+ *      again before rethrowing, so the index is unchanged.
+ * Parameters:
+ *      Node<DATA>* first : the first node to add
+ *      Node<DATA>* stop  : the node after the last one to add
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::indexRun(Node<DATA>* first, Node<DATA>* stop)
+{
+    if(!index_)
+        return;
+
+    Node<DATA>* node = first;
+    try
+    {
+        for(; node != stop; node = node->next)
+            index_->add(node);
+    }
+    catch(...)
+    {
+        for(Node<DATA>* added = first; added != node; added = added->next)
+            index_->remove(added);
+        throw;
+    }
+}
+
+/*************************************************************************** 
+ * Function: cutRun
+ * Description:
+ *      Cuts a run off after its first count nodes.
+ * Parameters:
+ *      Node<DATA>* run : first node of a run that ends in nullptr
+ *      size_t count    : how many nodes to keep in the run
+ * Return:
+ *      Node<DATA>* : the first node cut off, nullptr if there were no more
+***************************************************************************/
+template <typename DATA>
+Node<DATA>* SLL<DATA>::cutRun(Node<DATA>* run, size_t count)
+{
+    if(!run)
+        return nullptr;
+
+    while(--count && run->next)
+        run = run->next;
+
+    Node<DATA>* rest = run->next;
+    run->next = nullptr;
+    return rest;
+}
+
+/*************************************************************************** 
+ * Function: mergeRuns
+ * Description:
+ *      Merges two sorted runs (either may be nullptr) and links the result
+ *      after a given node. On ties the node from left goes first, which is
+ *      what makes sort() and merge() stable.
+ * Parameters:
+ *      Node<DATA>* tail  : the node to link the merged run after
+ *      Node<DATA>* left  : first sorted run, ends in nullptr
+ *      Node<DATA>* right : second sorted run, ends in nullptr
+ * Return:
+ *      Node<DATA>* : the last node of the merged run (tail if both are empty)
+***************************************************************************/
+template <typename DATA>
+Node<DATA>* SLL<DATA>::mergeRuns(Node<DATA>* tail, Node<DATA>* left, Node<DATA>* right)
+{
+    while(left && right)
+    {
+        if(right->data < left->data)
+        {
+            tail->next = right;
+            right = right->next;
+        }
+        else
+        {
+            tail->next = left;
+            left = left->next;
+        }
+        tail = tail->next;
+    }
+
+    // Whatever is left over is already sorted, it only needs its end found
+    tail->next = left ? left : right;
+    while(tail->next)
+        tail = tail->next;
+
+    return tail;
+}
+
+/*************************************************************************** 
+ * Function: createNode
+ * Description:
+ *      Creates a new node out of DATA's constructor arguments, in memory
+ *      from resource_.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      Node<DATA>* : the new node, not linked to anything
+***************************************************************************/
+template <typename DATA>
+template <typename... ARGS>
+Node<DATA>* SLL<DATA>::createNode(ARGS&&... args)
+{
+    std::pmr::polymorphic_allocator<Node<DATA>> allocator(resource_);
+    Node<DATA>* node = allocator.allocate(1);
+
+    try
+    {
+        allocator.construct(node, std::in_place, std::forward<ARGS>(args)...);
+    }
+    catch(...)
+    {
+        allocator.deallocate(node, 1);
+        throw;
+    }
+    return node;
+}
+
+/*************************************************************************** 
+ * Function: destroyNode
+ * Description:
+ *      Destroys a node made by createNode and gives its memory back. The
+ *      node must not be linked into the list anymore.
+ * Parameters:
+ *      Node<DATA>* node : the node to destroy
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::destroyNode(Node<DATA>* node)
+{
+    std::pmr::polymorphic_allocator<Node<DATA>> allocator(resource_);
+    std::destroy_at(node);
+    allocator.deallocate(node, 1);
 }
 
 /*====================================================================================================================*/
@@ -428,10 +923,10 @@ void SLL<DATA>::clear(std::shared_ptr<Node<DATA>> position)
  * Parameters:
  *      None
  * Return:
- *      Element of type DATA at the front of the list 
+ *      DATA const& : Element at the front of the list 
 ***************************************************************************/
 template <typename DATA>
-DATA SLL<DATA>::front(){
+DATA const& SLL<DATA>::front(){
     if(!this->size()){
         throw std::out_of_range("ERROR: cannot access the front of empty Queue");
     }
@@ -445,14 +940,14 @@ DATA SLL<DATA>::front(){
  * Parameters:
  *      None
  * Return:
- *      Element of type DATA at the back of the list 
+ *      DATA const& : Element at the back of the list 
 ***************************************************************************/
 template <typename DATA>
-DATA SLL<DATA>::back(){
+DATA const& SLL<DATA>::back(){
     if(!this->size()){
         throw std::out_of_range("ERROR: cannot access the back of empty Queue");
     }
-    return this->tail_->data;
+    return this->last_->data;
 }
 
 /*************************************************************************** 
@@ -471,7 +966,7 @@ void SLL<DATA>::print()
     std::cout << "\n";// formatting
 
     // tmp pointer used for iteration
-    std::shared_ptr<Node<DATA>> tmp(head_->next);
+    Node<DATA>* tmp = head_->next;
 
     std::cout << "[HEAD]-> ";
     while(tmp != tail_)
@@ -506,17 +1001,29 @@ size_t SLL<DATA>::size()
  * Function: search
  * Description:
  *      Looks for the given element in the list, and returns a pointer to the location
+ *      of its first occurrence. O(1) with an index enabled, unless the element
+ *      is in the list more than once.
  * Parameters:
  *      DATA element : the element to try to find in the list.
  * Return:
- *      std::shared_ptr<Node<DATA>> : pointer to the postion of the ele in the list. 
- *                                      nullptr if the element is not found.
+ *      Node<DATA>* : pointer to the postion of the ele in the list. 
+ *                    nullptr if the element is not found.
 ***************************************************************************/
 template <typename DATA>
-std::shared_ptr<Node<DATA>> SLL<DATA>::search(DATA element) 
+Node<DATA>* SLL<DATA>::search(DATA element) 
 {
+    // With an index, only an element held by several nodes needs the walk,
+    // since the index doesn't know which of them comes first
+    if(index_)
+    {
+        size_t matches = 0;
+        Node<DATA>* found = index_->find(element, matches);
+        if(matches < 2)
+            return found;
+    }
+
     // Create a pointer to move through the list. Start at the first element.
-    std::shared_ptr<Node<DATA>> position(head_->next);
+    Node<DATA>* position = head_->next;
 
     // Step through each element until position reachs the end of the list.
     while(position != tail_)
@@ -530,6 +1037,523 @@ std::shared_ptr<Node<DATA>> SLL<DATA>::search(DATA element)
     return nullptr;
 }
 
+/*************************************************************************** 
+ * Function: before_begin
+ * Description:
+ *      Returns the head sentinel. It holds no element, but can be passed to
+ *      insert_after, emplace_after and splice_after to work on the front of
+ *      the list.
+ * Parameters:
+ *      None
+ * Return:
+ *      Node<DATA>* : the position before the first element
+***************************************************************************/
+template <typename DATA>
+Node<DATA>* SLL<DATA>::before_begin()
+{
+    return head_;
+}
+
+/*************************************************************************** 
+ * Function: begin
+ * Description:
+ *      Returns an iterator to the first element.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator to the first element (end() if the list is empty)
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::iterator SLL<DATA>::begin()
+{
+    return iterator(head_->next);
+}
+
+/*************************************************************************** 
+ * Function: end
+ * Description:
+ *      Returns an iterator past the last element. It points at the tail
+ *      sentinel, so it stays valid however the list changes.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator past the last element
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::iterator SLL<DATA>::end()
+{
+    return iterator(tail_);
+}
+
+/*************************************************************************** 
+ * Function: begin
+ * Description:
+ *      Read only version of begin() for const lists.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first element
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::const_iterator SLL<DATA>::begin() const
+{
+    return const_iterator(head_->next);
+}
+
+/*************************************************************************** 
+ * Function: end
+ * Description:
+ *      Read only version of end() for const lists.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator past the last element
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::const_iterator SLL<DATA>::end() const
+{
+    return const_iterator(tail_);
+}
+
+/*************************************************************************** 
+ * Function: cbegin
+ * Description:
+ *      Returns a read only iterator to the first element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first element
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::const_iterator SLL<DATA>::cbegin() const
+{
+    return begin();
+}
+
+/*************************************************************************** 
+ * Function: cend
+ * Description:
+ *      Returns a read only iterator past the last element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator past the last element
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::const_iterator SLL<DATA>::cend() const
+{
+    return end();
+}
+
+/*************************************************************************** 
+ * Function: begin
+ * Description:
+ *      Returns an iterator to the first element that, as it moves along,
+ *      prefetches the node prefetchDistance steps ahead of it. The first
+ *      prefetchDistance nodes are walked right away to get the lookahead
+ *      started. Worth it on long lists whose nodes are scattered over
+ *      memory (after a sort(), or a lot of inserting and removing) and when
+ *      each element takes some work; a distance of 4 to 16 is typical.
+ * Parameters:
+ *      size_t prefetchDistance : how many nodes ahead to prefetch, 0 = none
+ * Return:
+ *      iterator : iterator to the first element
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::iterator SLL<DATA>::begin(size_t prefetchDistance)
+{
+    if(prefetchDistance == 0)
+        return begin();
+
+    Node<DATA>* ahead = head_->next;
+    for(size_t step = 0; step < prefetchDistance && ahead != tail_; step++)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ahead->next);
+#endif
+        ahead = ahead->next;
+    }
+
+    // A list shorter than the distance has nothing left to prefetch
+    return iterator(head_->next, ahead == tail_ ? nullptr : ahead);
+}
+
+/*************************************************************************** 
+ * Function: prefetched
+ * Description:
+ *      Returns begin(prefetchDistance) and end() as a range, for range-for.
+ * Parameters:
+ *      size_t prefetchDistance : how many nodes ahead to prefetch
+ * Return:
+ *      PrefetchedRange : the range
+***************************************************************************/
+template <typename DATA>
+typename SLL<DATA>::PrefetchedRange SLL<DATA>::prefetched(size_t prefetchDistance)
+{
+    return PrefetchedRange{begin(prefetchDistance), end()};
+}
+
+/*************************************************************************** 
+ * Function: enableIndex
+ * Description:
+ *      Builds a hash index of the list's current nodes and keeps it up to
+ *      date from then on, so search() doesn't have to walk the list. Every
+ *      insert and remove gets a little slower, and the index takes 32 to 64
+ *      bytes per element (see indexBytes()). An index that is already
+ *      there is rebuilt with the new HASH. Copies of the list don't inherit
+ *      the index.
+ *
+ *      While the index is on, don't change elements in place (through the
+ *      DATA& from emplace_*, an iterator or search()): the index files every
+ *      node under its element's hash when it's linked in, so a changed
+ *      element is only found again by a walk, and search() for the new
+ *      value misses it. Remove and re-insert it instead, or disableIndex()
+ *      first and enableIndex() again afterwards. Removing a changed node is
+ *      still safe, the index looks for it by address.
+ * Parameters:
+ *      HASH : hash function object for DATA, std::hash<DATA> by default
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+template <typename HASH>
+void SLL<DATA>::enableIndex()
+{
+    auto index = std::make_unique<HashNodeIndex<DATA, HASH>>(size_);
+    for(Node<DATA>* node = head_->next; node != tail_; node = node->next)
+        index->add(node);
+
+    index_ = std::move(index);
+}
+
+/*************************************************************************** 
+ * Function: disableIndex
+ * Description:
+ *      Drops the index, search() goes back to walking the list.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::disableIndex()
+{
+    index_.reset();
+}
+
+/*************************************************************************** 
+ * Function: indexed
+ * Description:
+ *      Tells whether the list keeps an index.
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true after enableIndex(), until disableIndex()
+***************************************************************************/
+template <typename DATA>
+bool SLL<DATA>::indexed() const
+{
+    return index_ != nullptr;
+}
+
+/*************************************************************************** 
+ * Function: indexBytes
+ * Description:
+ *      Returns how much memory the index takes, on top of the nodes.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : bytes used by the index, 0 without one
+***************************************************************************/
+template <typename DATA>
+size_t SLL<DATA>::indexBytes() const
+{
+    return index_ ? index_->bytes() : 0;
+}
+
+/*====================================================================================================================*/
+/* SERIALIZATION                                                                                                      */
+/*====================================================================================================================*/
+
+/*************************************************************************** 
+ * Function: save
+ * Description:
+ *      Writes the list to a binary stream, from head to tail.
+ * Parameters:
+ *      std::ostream& out : stream to write to (open it in binary mode)
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::save(std::ostream& out) const
+{
+    writeHeader<DATA>(out, ContainerTag::SLL, size_);
+
+    for(Node<DATA>* position = head_->next; position != tail_; position = position->next)
+        writeElement(out, position->data);
+}
+
+/*************************************************************************** 
+ * Function: load
+ * Description:
+ *      Replaces the contents of the list with a list written by save().
+ *      Every node is linked in behind the previous one, so the order is
+ *      kept without walking the list again.
+ * Parameters:
+ *      std::istream& in : stream to read from (open it in binary mode)
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::load(std::istream& in)
+{
+    uint64_t count = readHeader<DATA>(in, ContainerTag::SLL);
+
+    clear();
+
+    for(uint64_t index = 0; index < count; index++)
+    {
+        // Read before making the node, so a failed read leaks nothing
+        DATA element;
+        readElement(in, element);
+
+        Node<DATA>* to_add = createNode(std::move(element));
+        indexNode(to_add);
+        to_add->next = tail_;
+        last_->next = to_add;
+        last_ = to_add;
+        size_++;
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF SERIALIZATION                                                                                               */
+/*====================================================================================================================*/
+
+/*====================================================================================================================*/
+/* SPLICING AND SORTING                                                                                               */
+/*====================================================================================================================*/
+
+/*************************************************************************** 
+ * Function: splice_after
+ * Description:
+ *      Moves every node of another list into this one, after position. The
+ *      other list ends up empty. No node is copied or allocated.
+ * Parameters:
+ *      Node<DATA>* position : the node to put the other list's nodes after
+ *      SLL& other           : the list to take the nodes from
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::splice_after(Node<DATA>* position, SLL& other)
+{
+    splice_after(position, other, other.head_, other.tail_);
+}
+
+/*************************************************************************** 
+ * Function: splice_after
+ * Description:
+ *      Moves the nodes strictly between first and last out of another list
+ *      (which may be this one) and puts them after position. Pass
+ *      other.before_begin() as first to start at the front of other, and
+ *      nullptr as last to go to the end of it. position must not be one of
+ *      the moved nodes. Both lists must allocate from the same memory
+ *      resource, since the nodes change owner.
+ * Parameters:
+ *      Node<DATA>* position : the node to put the moved nodes after
+ *      SLL& other           : the list the nodes are in
+ *      Node<DATA>* first    : the node before the first one to move
+ *      Node<DATA>* last     : the node after the last one to move
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::splice_after(Node<DATA>* position, SLL& other, Node<DATA>* first, Node<DATA>* last)
+{
+    if(!position || position == this->tail_ || !first || first == other.tail_)
+        throw std::out_of_range("INVALID POSITION GIVEN!");
+    if(!resource_->is_equal(*other.resource_))
+        throw std::invalid_argument("LISTS MUST SHARE A MEMORY RESOURCE!");
+
+    if(!last)
+        last = other.tail_;
+
+    // Nothing between first and last
+    if(first->next == last)
+        return;
+
+    // Find the last node that moves, counting as we go
+    Node<DATA>* begin = first->next;
+    Node<DATA>* end = begin;
+    size_t count = 1;
+    while(end->next != last)
+    {
+        end = end->next;
+        count++;
+    }
+
+    // Move the nodes from one index to the other. Adding can throw, so it
+    // goes first, while nothing has changed yet.
+    if(&other != this)
+    {
+        indexRun(begin, last);
+        if(other.index_)
+            for(Node<DATA>* node = begin; node != last; node = node->next)
+                other.index_->remove(node);
+    }
+
+    // Take them out of other...
+    first->next = last;
+    if(end == other.last_)
+        other.last_ = first;
+    other.size_ -= count;
+
+    // ...and link them in after position
+    end->next = position->next;
+    position->next = begin;
+    if(position == last_)
+        last_ = end;
+    size_ += count;
+}
+
+/*************************************************************************** 
+ * Function: merge
+ * Description:
+ *      Merges another list into this one. Both have to be sorted (by
+ *      operator<); the result is sorted, and equal elements from this list
+ *      stay in front of the ones from other. The other list ends up empty.
+ *      Both lists must allocate from the same memory resource.
+ * Parameters:
+ *      SLL& other : the sorted list to merge in
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::merge(SLL& other)
+{
+    if(&other == this || other.size_ == 0)
+        return;
+    if(!resource_->is_equal(*other.resource_))
+        throw std::invalid_argument("LISTS MUST SHARE A MEMORY RESOURCE!");
+
+    indexRun(other.head_->next, other.tail_);
+    if(other.index_)
+        other.index_->clear();
+
+    // Cut both lists loose from their sentinels
+    Node<DATA>* ours = size_ ? head_->next : nullptr;
+    last_->next = nullptr;
+    Node<DATA>* theirs = other.head_->next;
+    other.last_->next = nullptr;
+
+    last_ = mergeRuns(head_, ours, theirs);
+    last_->next = tail_;
+    size_ += other.size_;
+
+    other.head_->next = other.tail_;
+    other.last_ = other.head_;
+    other.size_ = 0;
+}
+
+/*************************************************************************** 
+ * Function: sort
+ * Description:
+ *      Sorts the list by operator<, keeping equal elements in their order.
+ *      This is a bottom-up merge sort: each pass merges neighbouring sorted
+ *      runs of width 1, 2, 4, ... so it takes O(n log n) time in every case,
+ *      and only relinks nodes, with no recursion and no extra memory.
+ * Parameters:
+ *      None
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void SLL<DATA>::sort()
+{
+    // Nothing to sort!
+    if(size_ <= 1)
+        return;
+
+    last_->next = nullptr;
+
+    for(size_t width = 1; width < size_; width *= 2)
+    {
+        Node<DATA>* rest = head_->next;
+        Node<DATA>* sorted = head_; // last node of what's been merged this pass
+
+        while(rest)
+        {
+            Node<DATA>* left = rest;
+            Node<DATA>* right = cutRun(left, width);
+            rest = cutRun(right, width);
+
+            sorted = mergeRuns(sorted, left, right);
+        }
+
+        last_ = sorted;
+    }
+
+    last_->next = tail_;
+}
+
+/*************************************************************************** 
+ * Function: unique
+ * Description:
+ *      Removes every element that is equal (by operator==) to the one right
+ *      before it, so a sorted list ends up with no duplicates. The removed
+ *      nodes are collected into one chain and destroyed together.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : the number of elements removed
+***************************************************************************/
+template <typename DATA>
+size_t SLL<DATA>::unique()
+{
+    if(size_ <= 1)
+        return 0;
+
+    Node<DATA>* removed = nullptr;     // chain of removed nodes
+    Node<DATA>* removedLast = nullptr;
+    size_t count = 0;
+
+    Node<DATA>* kept = head_->next;
+    while(kept->next != tail_)
+    {
+        Node<DATA>* next = kept->next;
+        if(!(next->data == kept->data))
+        {
+            kept = next;
+            continue;
+        }
+
+        kept->next = next->next;
+        if(index_)
+            index_->remove(next);
+        if(removedLast)
+            removedLast->next = next;
+        else
+            removed = next;
+        removedLast = next;
+        count++;
+    }
+
+    if(removedLast)
+    {
+        removedLast->next = nullptr;
+        destroyNodes(removed, nullptr);
+    }
+
+    last_ = kept;
+    size_ -= count;
+    return count;
+}
+
+/*====================================================================================================================*/
+/* END OF SPLICING AND SORTING                                                                                        */
+/*====================================================================================================================*/
+
 /*====================================================================================================================*/
 /* FUN FUNCTIONS                                                                                                      */
 /*====================================================================================================================*/
@@ -551,9 +1575,12 @@ void SLL<DATA>::reverse()
         return;
     
     // Create three pointers, initially at the first three elements in the list
-    std::shared_ptr<Node<DATA>> p1 = head_->next;
-    std::shared_ptr<Node<DATA>> p2 = p1->next;
-    std::shared_ptr<Node<DATA>> p3 = p2->next;
+    Node<DATA>* p1 = head_->next;
+    Node<DATA>* p2 = p1->next;
+    Node<DATA>* p3 = p2->next;
+
+    // The first node is about to become the last
+    last_ = p1;
 
 
     p1->next = tail_;
@@ -0,0 +1,837 @@
+/*************************************************************************************************
+* File: Skip-List.hpp
+* Description:
+*       A skip list: a sorted singly linked list of key/value pairs where each node also has a
+*       "tower" of extra next pointers. Level 0 links every node, like SLL. Each level above it
+*       links a random subset of the level below: a node reaches level i + 1 with probability p.
+*       A search starts at the top level, runs right while the next key is smaller, and drops a
+*       level when it would overshoot. That skips most of the list, so search, insert and erase
+*       take O(log n) expected time instead of SLL's O(n).
+*
+*       The probability p is tunable (0.25 by default). A lower p means shorter towers, so less
+*       memory (1 / (1 - p) pointers per node on average) and more steps per level; a higher p
+*       the other way around. Each node's tower is allocated with the node in one block, from
+*       the process wide NodePoolResource unless a memory resource is given.
+*
+*       Iterating goes along level 0, so it visits the keys in order, and range(lo, hi) gives
+*       the keys in [lo, hi). Like std::map, an iterator points at a std::pair<const KEY, VALUE>.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the idea, refer to the following:
+*       Link: https://en.wikipedia.org/wiki/Skip_list
+*       Link: https://15721.courses.cs.cmu.edu/spring2018/papers/08-oltpindexes1/pugh-skiplists-cacm1990.pdf
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Memory-Resources.hpp"
+
+template <typename KEY, typename VALUE>
+struct SkipNode
+{
+    std::pair<const KEY, VALUE> entry; // Key Value Pair
+    size_t height;                     // Number of levels in the tower
+    SkipNode* next[1];                 // The tower, really height pointers long (allocated with the node)
+
+    template <typename K, typename V>
+    SkipNode(size_t levels, K&& key, V&& value) :
+    entry(std::forward<K>(key), std::forward<V>(value)), height(levels) {}
+};
+
+// Forward iterator over a SkipList, in key order
+template <typename KEY, typename VALUE, bool CONST>
+class SkipListIterator
+{
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<const KEY, VALUE>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<CONST, const value_type*, value_type*>;
+        using reference         = std::conditional_t<CONST, const value_type&, value_type&>;
+
+        SkipListIterator() : node_(nullptr) {}
+        explicit SkipListIterator(SkipNode<KEY, VALUE>* node) : node_(node) {}
+        // An iterator converts to a const_iterator
+        template <bool OTHER, typename = std::enable_if_t<CONST && !OTHER>>
+        SkipListIterator(const SkipListIterator<KEY, VALUE, OTHER>& other) : node_(other.node()) {}
+
+        reference operator*() const { return node_->entry; }
+        pointer operator->() const { return &node_->entry; }
+
+        SkipListIterator& operator++() { node_ = node_->next[0]; return *this; }
+        SkipListIterator operator++(int) { SkipListIterator old = *this; node_ = node_->next[0]; return old; }
+
+        friend bool operator==(const SkipListIterator& lhs, const SkipListIterator& rhs) { return lhs.node_ == rhs.node_; }
+        friend bool operator!=(const SkipListIterator& lhs, const SkipListIterator& rhs) { return lhs.node_ != rhs.node_; }
+
+        SkipNode<KEY, VALUE>* node() const { return node_; }
+
+    private:
+        SkipNode<KEY, VALUE>* node_; // nullptr at the end
+};
+
+template <typename KEY, typename VALUE>
+class SkipList
+{
+    public:
+        // Towers never get taller than this (plenty for 2^32 nodes at p = 0.5)
+        static constexpr size_t MAX_LEVEL = 32;
+
+        using iterator       = SkipListIterator<KEY, VALUE, false>;
+        using const_iterator = SkipListIterator<KEY, VALUE, true>;
+
+        // A begin/end pair, for range-for over part of the list
+        template <typename ITER>
+        struct Range
+        {
+            ITER first;
+            ITER last;
+            ITER begin() const { return first; }
+            ITER end() const { return last; }
+        };
+
+        // Default Constructor
+        SkipList();
+        // Constructor with the chance of a tower growing one more level (0 < probability < 1)
+        explicit SkipList(double probability, std::pmr::memory_resource* resource = &NodePoolResource::instance());
+        // Destructor
+        ~SkipList();
+        // Copy Constructor
+        SkipList(const SkipList& objectToCopy);
+        // Copy Assignment Operator
+        SkipList& operator=(const SkipList& objectToCopy);
+
+        // Mutators
+        bool insert(const KEY& key, const VALUE& value); // false if the key was there (its value is replaced)
+        bool insert(KEY&& key, VALUE&& value);
+        bool erase(const KEY& key);                      // false if the key wasn't there
+        void clear();
+
+        // Accessors
+        VALUE* search(const KEY& key);  // nullptr if the key isn't there
+        const VALUE* search(const KEY& key) const;
+        bool contains(const KEY& key) const;
+        size_t size() const;
+        double probability() const;
+        void print();
+
+        // Iterators, in key order
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        iterator lower_bound(const KEY& key); // first key not less than key
+        const_iterator lower_bound(const KEY& key) const;
+        Range<iterator> range(const KEY& low, const KEY& high); // keys in [low, high)
+        Range<const_iterator> range(const KEY& low, const KEY& high) const;
+
+    private:
+        using Node = SkipNode<KEY, VALUE>;
+
+        std::pmr::memory_resource* resource_; // Where the nodes are allocated from
+
+        Node* head_[MAX_LEVEL]; // First node on every level
+        size_t levels_;         // Levels in use (height of the tallest tower)
+        size_t size_;           // Number of nodes
+
+        uint64_t threshold_;    // A random 64 bit number below this means "one more level"
+        uint64_t random_;       // xorshift64* state
+
+        // Fills links[level] with the address of the last link before key on every level
+        Node* findLinks(const KEY& key, Node** links[MAX_LEVEL]) const;
+        Node* lowerBound(const KEY& key) const;
+        template <typename K, typename V>
+        bool insertEntry(K&& key, V&& value);
+        size_t randomHeight();
+        template <typename K, typename V>
+        Node* createNode(size_t height, K&& key, V&& value);
+        void destroyNode(Node* node);
+        static size_t nodeBytes(size_t height);
+};
+
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                              */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: SkipList
+ * Description:
+ *      Creates an empty skip list with p = 0.25, taking its nodes from the
+ *      shared node pool.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename KEY, typename VALUE>
+SkipList<KEY, VALUE>::SkipList() : SkipList(0.25) {}
+
+/***************************************************************************
+ * Function: SkipList
+ * Description:
+ *      Creates an empty skip list.
+ * Parameters:
+ *      double probability                  : chance of a tower growing one
+ *                                            more level, 0 < probability < 1
+ *      std::pmr::memory_resource* resource : where to allocate the nodes,
+ *                                            has to outlive the list
+ * Return:
+ *      None
+***************************************************************************/
+template <typename KEY, typename VALUE>
+SkipList<KEY, VALUE>::SkipList(double probability, std::pmr::memory_resource* resource) :
+resource_(resource), head_{}, levels_(1), size_(0), threshold_(0), random_(0x9E3779B97F4A7C15ull)
+{
+    if(!(probability > 0.0 && probability < 1.0))
+        throw std::invalid_argument("PROBABILITY MUST BE BETWEEN 0 AND 1!");
+
+    // probability * 2^64, as a 64 bit number
+    threshold_ = static_cast<uint64_t>(probability * 18446744073709551616.0);
+}
+
+/***************************************************************************
+ * Function: ~SkipList
+ * Description:
+ *      Frees every node, walking level 0.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename KEY, typename VALUE>
+SkipList<KEY, VALUE>::~SkipList()
+{
+    clear();
+}
+
+/***************************************************************************
+ * Function: SkipList
+ * Description:
+ *      The copy constructor. Uses the same probability and resource.
+ * Parameters:
+ *      const SkipList& objectToCopy : list to copy from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename KEY, typename VALUE>
+SkipList<KEY, VALUE>::SkipList(const SkipList& objectToCopy) :
+SkipList(objectToCopy.probability(), objectToCopy.resource_)
+{
+    *this = objectToCopy;
+}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The copy assignment operator. The keys arrive in order, so each node
+ *      is linked in at the end of every level it reaches, without
+ *      searching: O(n) in total. The copy gets new random towers.
+ * Parameters:
+ *      const SkipList& rhs : list to copy from
+ * Return:
+ *      SkipList& : this list
+***************************************************************************/
+template <typename KEY, typename VALUE>
+SkipList<KEY, VALUE>& SkipList<KEY, VALUE>::operator=(const SkipList& rhs)
+{
+    if(&rhs == this)
+        return *this;
+
+    clear();
+
+    // The last link on every level
+    Node** last[MAX_LEVEL];
+    for(size_t level = 0; level < MAX_LEVEL; level++)
+        last[level] = &head_[level];
+
+    for(Node* source = rhs.head_[0]; source; source = source->next[0])
+    {
+        size_t height = randomHeight();
+        Node* node = createNode(height, source->entry.first, source->entry.second);
+
+        for(size_t level = 0; level < height; level++)
+        {
+            node->next[level] = nullptr;
+            *last[level] = node;
+            last[level] = &node->next[level];
+        }
+
+        if(height > levels_)
+            levels_ = height;
+        size_++;
+    }
+    return *this;
+}
+
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                       */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: insert
+ * Description:
+ *      Inserts a copy of a key/value pair in its sorted place. An equal key
+ *      keeps its node and gets the new value, like BST does.
+ * Parameters:
+ *      const KEY& key     : the key
+ *      const VALUE& value : the value
+ * Return:
+ *      bool : true if a new node was added
+***************************************************************************/
+template <typename KEY, typename VALUE>
+bool SkipList<KEY, VALUE>::insert(const KEY& key, const VALUE& value)
+{
+    return insertEntry(key, value);
+}
+
+/***************************************************************************
+ * Function: insert
+ * Description:
+ *      Moves a key/value pair into its sorted place. An equal key keeps its
+ *      node and gets the new value.
+ * Parameters:
+ *      KEY&& key     : the key
+ *      VALUE&& value : the value
+ * Return:
+ *      bool : true if a new node was added
+***************************************************************************/
+template <typename KEY, typename VALUE>
+bool SkipList<KEY, VALUE>::insert(KEY&& key, VALUE&& value)
+{
+    return insertEntry(std::move(key), std::move(value));
+}
+
+/***************************************************************************
+ * Function: erase
+ * Description:
+ *      Removes the node with the given key, unlinking it on every level of
+ *      its tower.
+ * Parameters:
+ *      const KEY& key : the key to remove
+ * Return:
+ *      bool : true if there was such a node
+***************************************************************************/
+template <typename KEY, typename VALUE>
+bool SkipList<KEY, VALUE>::erase(const KEY& key)
+{
+    Node** links[MAX_LEVEL];
+    Node* node = findLinks(key, links);
+    if(!node || key < node->entry.first)
+        return false;
+
+    for(size_t level = 0; level < node->height; level++)
+        *links[level] = node->next[level];
+
+    // The tallest tower may have gone
+    while(levels_ > 1 && !head_[levels_ - 1])
+        levels_--;
+
+    destroyNode(node);
+    size_--;
+    return true;
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Removes every node.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename KEY, typename VALUE>
+void SkipList<KEY, VALUE>::clear()
+{
+    Node* node = head_[0];
+    while(node)
+    {
+        Node* next = node->next[0];
+        destroyNode(node);
+        node = next;
+    }
+
+    for(size_t level = 0; level < MAX_LEVEL; level++)
+        head_[level] = nullptr;
+    levels_ = 1;
+    size_ = 0;
+}
+
+/*====================================================================================================================*/
+/* END OF MUTATORS                                                                                                    */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: search
+ * Description:
+ *      Looks for a key.
+ * Parameters:
+ *      const KEY& key : the key to try to find
+ * Return:
+ *      VALUE* : its value, nullptr if the key isn't in the list
+***************************************************************************/
+template <typename KEY, typename VALUE>
+VALUE* SkipList<KEY, VALUE>::search(const KEY& key)
+{
+    Node* node = lowerBound(key);
+    if(!node || key < node->entry.first)
+        return nullptr;
+    return &node->entry.second;
+}
+
+/***************************************************************************
+ * Function: search
+ * Description:
+ *      Read only version of search() for const lists.
+ * Parameters:
+ *      const KEY& key : the key to try to find
+ * Return:
+ *      const VALUE* : its value, nullptr if the key isn't in the list
+***************************************************************************/
+template <typename KEY, typename VALUE>
+const VALUE* SkipList<KEY, VALUE>::search(const KEY& key) const
+{
+    Node* node = lowerBound(key);
+    if(!node || key < node->entry.first)
+        return nullptr;
+    return &node->entry.second;
+}
+
+/***************************************************************************
+ * Function: contains
+ * Description:
+ *      Tells whether a key is in the list.
+ * Parameters:
+ *      const KEY& key : the key
+ * Return:
+ *      bool : true if it is
+***************************************************************************/
+template <typename KEY, typename VALUE>
+bool SkipList<KEY, VALUE>::contains(const KEY& key) const
+{
+    return search(key) != nullptr;
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the number of key/value pairs.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : size of the list
+***************************************************************************/
+template <typename KEY, typename VALUE>
+size_t SkipList<KEY, VALUE>::size() const
+{
+    return size_;
+}
+
+/***************************************************************************
+ * Function: probability
+ * Description:
+ *      Returns the chance of a tower growing one more level.
+ * Parameters:
+ *      None
+ * Return:
+ *      double : the probability given to the constructor
+***************************************************************************/
+template <typename KEY, typename VALUE>
+double SkipList<KEY, VALUE>::probability() const
+{
+    return static_cast<double>(threshold_) / 18446744073709551616.0;
+}
+
+/***************************************************************************
+ * Function: print
+ * Description:
+ *      Prints every level from the top down, so the towers show.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename KEY, typename VALUE>
+void SkipList<KEY, VALUE>::print()
+{
+    if(size_ == 0) return;// cannot print an empty list!
+    std::cout << "\n";// formatting
+
+    for(size_t level = levels_; level > 0; level--)
+    {
+        std::cout << "[LEVEL " << level - 1 << "]-> ";
+        for(Node* node = head_[level - 1]; node; node = node->next[level - 1])
+            std::cout << node->entry.first << ":" << node->entry.second << "-> ";
+        std::cout << "nullptr\n";
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* ITERATORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: begin
+ * Description:
+ *      Returns an iterator to the smallest key.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator to the first pair (end() if the list is empty)
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::iterator SkipList<KEY, VALUE>::begin()
+{
+    return iterator(head_[0]);
+}
+
+/***************************************************************************
+ * Function: end
+ * Description:
+ *      Returns an iterator past the largest key.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator past the last pair
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::iterator SkipList<KEY, VALUE>::end()
+{
+    return iterator(nullptr);
+}
+
+/***************************************************************************
+ * Function: begin
+ * Description:
+ *      Read only version of begin() for const lists.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first pair
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::const_iterator SkipList<KEY, VALUE>::begin() const
+{
+    return const_iterator(head_[0]);
+}
+
+/***************************************************************************
+ * Function: end
+ * Description:
+ *      Read only version of end() for const lists.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator past the last pair
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::const_iterator SkipList<KEY, VALUE>::end() const
+{
+    return const_iterator(nullptr);
+}
+
+/***************************************************************************
+ * Function: lower_bound
+ * Description:
+ *      Finds the first key that isn't less than the given one, in O(log n)
+ *      expected time.
+ * Parameters:
+ *      const KEY& key : the key
+ * Return:
+ *      iterator : iterator to that pair, end() if every key is smaller
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::iterator SkipList<KEY, VALUE>::lower_bound(const KEY& key)
+{
+    return iterator(lowerBound(key));
+}
+
+/***************************************************************************
+ * Function: lower_bound
+ * Description:
+ *      Read only version of lower_bound() for const lists.
+ * Parameters:
+ *      const KEY& key : the key
+ * Return:
+ *      const_iterator : iterator to that pair, end() if every key is smaller
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::const_iterator SkipList<KEY, VALUE>::lower_bound(const KEY& key) const
+{
+    return const_iterator(lowerBound(key));
+}
+
+/***************************************************************************
+ * Function: range
+ * Description:
+ *      Returns the pairs whose keys are in [low, high), for a range scan:
+ *      for(auto& [key, value] : list.range(10, 20)). Finding the start takes
+ *      O(log n), then it's a plain walk along level 0.
+ * Parameters:
+ *      const KEY& low  : smallest key wanted
+ *      const KEY& high : first key not wanted
+ * Return:
+ *      Range<iterator> : the pairs, empty if high <= low
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::template Range<typename SkipList<KEY, VALUE>::iterator>
+SkipList<KEY, VALUE>::range(const KEY& low, const KEY& high)
+{
+    if(!(low < high))
+        return Range<iterator>{end(), end()};
+    return Range<iterator>{lower_bound(low), lower_bound(high)};
+}
+
+/***************************************************************************
+ * Function: range
+ * Description:
+ *      Read only version of range() for const lists.
+ * Parameters:
+ *      const KEY& low  : smallest key wanted
+ *      const KEY& high : first key not wanted
+ * Return:
+ *      Range<const_iterator> : the pairs, empty if high <= low
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::template Range<typename SkipList<KEY, VALUE>::const_iterator>
+SkipList<KEY, VALUE>::range(const KEY& low, const KEY& high) const
+{
+    if(!(low < high))
+        return Range<const_iterator>{end(), end()};
+    return Range<const_iterator>{lower_bound(low), lower_bound(high)};
+}
+
+/*====================================================================================================================*/
+/* END OF ITERATORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: findLinks
+ * Description:
+ *      Walks down from the top level, and on every level records the
+ *      address of the last link that points before key: either a slot of
+ *      head_ or a slot in some node's tower. Those are the links an insert
+ *      or erase of key has to change.
+ * Parameters:
+ *      const KEY& key          : the key
+ *      Node** links[MAX_LEVEL] : filled in for levels 0 to levels_ - 1
+ * Return:
+ *      Node* : the first node not less than key, nullptr if there isn't one
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::Node* SkipList<KEY, VALUE>::findLinks(const KEY& key, Node** links[MAX_LEVEL]) const
+{
+    // The tower being walked, head_ to start with
+    Node** tower = const_cast<Node**>(head_);
+
+    for(size_t level = levels_; level > 0; level--)
+    {
+        while(tower[level - 1] && tower[level - 1]->entry.first < key)
+            tower = tower[level - 1]->next;
+        links[level - 1] = &tower[level - 1];
+    }
+    return tower[0];
+}
+
+/***************************************************************************
+ * Function: lowerBound
+ * Description:
+ *      findLinks() without recording the links.
+ * Parameters:
+ *      const KEY& key : the key
+ * Return:
+ *      Node* : the first node not less than key, nullptr if there isn't one
+***************************************************************************/
+template <typename KEY, typename VALUE>
+typename SkipList<KEY, VALUE>::Node* SkipList<KEY, VALUE>::lowerBound(const KEY& key) const
+{
+    Node* const* tower = head_;
+
+    for(size_t level = levels_; level > 0; level--)
+        while(tower[level - 1] && tower[level - 1]->entry.first < key)
+            tower = tower[level - 1]->next;
+
+    return tower[0];
+}
+
+/***************************************************************************
+ * Function: insertEntry
+ * Description:
+ *      Finds where key goes, then either replaces the value of an equal key
+ *      or links a new node with a random tower in on each of its levels.
+ * Parameters:
+ *      K&& key   : the key
+ *      V&& value : the value
+ * Return:
+ *      bool : true if a new node was added
+***************************************************************************/
+template <typename KEY, typename VALUE>
+template <typename K, typename V>
+bool SkipList<KEY, VALUE>::insertEntry(K&& key, V&& value)
+{
+    Node** links[MAX_LEVEL];
+    Node* found = findLinks(key, links);
+    if(found && !(key < found->entry.first))
+    {
+        found->entry.second = std::forward<V>(value);
+        return false;
+    }
+
+    size_t height = randomHeight();
+    for(; levels_ < height; levels_++)
+        links[levels_] = &head_[levels_];
+
+    Node* node = createNode(height, std::forward<K>(key), std::forward<V>(value));
+    for(size_t level = 0; level < height; level++)
+    {
+        node->next[level] = *links[level];
+        *links[level] = node;
+    }
+
+    size_++;
+    return true;
+}
+
+/***************************************************************************
+ * Function: randomHeight
+ * Description:
+ *      Picks a tower height: 1, plus one more level for as long as a random
+ *      number comes out below probability (so height h has chance
+ *      p^(h-1) * (1 - p)). Uses xorshift64*, which is fast and plenty
+ *      random for this.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : the height, 1 to MAX_LEVEL
+***************************************************************************/
+template <typename KEY, typename VALUE>
+size_t SkipList<KEY, VALUE>::randomHeight()
+{
+    size_t height = 1;
+    while(height < MAX_LEVEL)
+    {
+        random_ ^= random_ >> 12;
+        random_ ^= random_ << 25;
+        random_ ^= random_ >> 27;
+        if(random_ * 0x2545F4914F6CDD1Dull >= threshold_)
+            break;
+        height++;
+    }
+    return height;
+}
+
+/***************************************************************************
+ * Function: createNode
+ * Description:
+ *      Allocates a node with room for a tower of the given height right
+ *      after it, in one block from resource_.
+ * Parameters:
+ *      size_t height : levels in the tower
+ *      K&& key       : the key
+ *      V&& value     : the value
+ * Return:
+ *      Node* : the new node, its tower not yet linked
+***************************************************************************/
+template <typename KEY, typename VALUE>
+template <typename K, typename V>
+typename SkipList<KEY, VALUE>::Node* SkipList<KEY, VALUE>::createNode(size_t height, K&& key, V&& value)
+{
+    void* memory = resource_->allocate(nodeBytes(height), alignof(Node));
+
+    try
+    {
+        return ::new (memory) Node(height, std::forward<K>(key), std::forward<V>(value));
+    }
+    catch(...)
+    {
+        resource_->deallocate(memory, nodeBytes(height), alignof(Node));
+        throw;
+    }
+}
+
+/***************************************************************************
+ * Function: destroyNode
+ * Description:
+ *      Destroys a node and gives its block back to resource_. The node must
+ *      already be unlinked.
+ * Parameters:
+ *      Node* node : the node to destroy
+ * Return:
+ *      None
+***************************************************************************/
+template <typename KEY, typename VALUE>
+void SkipList<KEY, VALUE>::destroyNode(Node* node)
+{
+    size_t bytes = nodeBytes(node->height);
+    std::destroy_at(node);
+    resource_->deallocate(node, bytes, alignof(Node));
+}
+
+/***************************************************************************
+ * Function: nodeBytes
+ * Description:
+ *      Returns the size of a node with a tower of the given height.
+ * Parameters:
+ *      size_t height : levels in the tower
+ * Return:
+ *      size_t : bytes to allocate
+***************************************************************************/
+template <typename KEY, typename VALUE>
+size_t SkipList<KEY, VALUE>::nodeBytes(size_t height)
+{
+    return sizeof(Node) + (height - 1) * sizeof(Node*);
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+#endif //SKIP_LIST_H
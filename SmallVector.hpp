@@ -0,0 +1,1140 @@
+/*************************************************************************************************
+* File: SmallVector.hpp
+* Description:
+*       A Vector that keeps its first N elements inside the object itself, and only goes to the
+*       heap once it outgrows them. The elements are handled like in the Vector in Vector.hpp
+*       (push/emplace/insert/erase, indexing, data() and iterators), but there is no memory
+*       resource, growth policy or save()/load(): the inline buffer can't come from a resource,
+*       and once on the heap it just doubles.
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For a similar implementation, refer to the following:
+*       Link: https://llvm.org/doxygen/classllvm_1_1SmallVector.html
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <iostream>
+#include <stdexcept>
+#include <memory>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+
+template<typename DATA, size_t N = 16>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector needs room for at least one inline element");
+
+    public:
+        using value_type     = DATA;
+        // The elements are contiguous, so plain pointers do as iterators
+        using iterator       = DATA*;
+        using const_iterator = const DATA*;
+
+        // Default Constructor
+        SmallVector();
+        // Overloaded Constructor
+        SmallVector(int);
+        //Destructor
+        ~SmallVector();
+        // Copy Constructor
+        SmallVector(const SmallVector & objectToCopy);
+        // Move Constructor
+        SmallVector(SmallVector&& objectToMove) noexcept(std::is_nothrow_move_constructible<DATA>::value);
+        // Copy Assignment Operator
+        SmallVector<DATA, N>& operator=(const SmallVector &objectToCopy);
+        // Move Assignment Operator
+        SmallVector<DATA, N>& operator=(SmallVector&& objectToMove) noexcept(std::is_nothrow_move_constructible<DATA>::value);
+
+        // Mutators
+        void push_back(const DATA& data);
+        void push_back(DATA&& data);
+        template <typename... ARGS>
+        DATA& emplace_back(ARGS&&... args);
+        void insertAt(size_t index, const DATA& data);
+        void insertAt(size_t index, DATA&& data);
+        template <typename ITER>
+        void insert(size_t index, ITER first, ITER last);
+        template <typename RANGE>
+        void append(const RANGE& range);
+        void erase(size_t first, size_t last);
+        template <typename PREDICATE>
+        size_t erase_if(PREDICATE pred);
+        void clear();
+        void pop_back();
+        void reserve(size_t newCapacity);
+        void shrink_to_fit();
+
+        // Accessors
+        DATA const& front();
+        DATA const& back();
+        size_t const& size() const;
+        size_t const& capacity() const;
+        bool empty() const;
+        DATA& operator[](size_t index);
+        DATA const& operator[](size_t index) const;
+        DATA& at(size_t index);
+        DATA const& at(size_t index) const;
+        DATA* data();
+        const DATA* data() const;
+        // True while the elements still live in the inline buffer
+        bool isInline() const;
+
+        // Iterators
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+        // Used for testing purposes
+        void displayVector();
+
+    private:
+        // Inline storage for the first N elements. Raw bytes, so nothing is
+        // constructed until an element is pushed.
+        alignas(DATA) unsigned char inline_[N * sizeof(DATA)];
+
+        // Points at inline_ or at the heap buffer once we've spilled over
+        DATA* array_;
+
+        // Used to keep track of contents
+        size_t capacity_;
+        size_t size_;
+
+        static constexpr bool TRIVIAL = std::is_trivially_copyable<DATA>::value;
+
+        // Called when expanding the SmallVector
+        void resize();
+        // Moves the live elements into the given buffer (heap or inline)
+        void reallocate(size_t newCapacity);
+        static void relocate(DATA* from, size_t count, DATA* to);
+        DATA* inlineBuffer();
+        // Destroys the live elements and frees any heap buffer
+        void release();
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                              */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: SmallVector (Default Constructor)
+ * Description:
+ *      Creates an empty SmallVector that uses its inline buffer. No memory
+ *      is allocated.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+SmallVector<DATA, N>::SmallVector() : array_(inlineBuffer()), capacity_(N), size_(0) {}
+
+/***************************************************************************
+ * Function: SmallVector
+ * Description:
+ *      An overloaded constructor that creates a new SmallVector with a user
+ *      defined capacity. Only goes to the heap if it's more than N.
+ * Parameters:
+ *      int userDefinedCapacity : integer that will determine the initial
+ *                                capacity of the vector.
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+SmallVector<DATA, N>::SmallVector(int userDefinedCapacity) : SmallVector()
+{
+    if(userDefinedCapacity > 0)
+        reserve(userDefinedCapacity);
+}
+
+/***************************************************************************
+ * Function: SmallVector (Copy Constructor)
+ * Description:
+ *      Copies the contents of another SmallVector. Stays inline if the
+ *      elements fit.
+ * Parameters:
+ *      const SmallVector &objectToCopy : SmallVector to copy from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+SmallVector<DATA, N>::SmallVector(const SmallVector &objectToCopy) : SmallVector()
+{
+    reserve(objectToCopy.size_);
+
+    try
+    {
+        for(; size_ < objectToCopy.size_; size_++)
+            ::new (static_cast<void*>(array_ + size_)) DATA(objectToCopy.array_[size_]);
+    }
+    catch(...)
+    {
+        release();
+        throw;
+    }
+}
+
+/***************************************************************************
+ * Function: SmallVector (Move Constructor)
+ * Description:
+ *      Takes over a heap buffer as is. Inline elements can't be stolen, so
+ *      they are moved one by one into our own inline buffer. Either way the
+ *      old SmallVector is left empty.
+ * Parameters:
+ *      SmallVector&& objectToMove : SmallVector to move contents from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+SmallVector<DATA, N>::SmallVector(SmallVector&& objectToMove) noexcept(std::is_nothrow_move_constructible<DATA>::value)
+: SmallVector()
+{
+    *this = std::move(objectToMove);
+}
+
+/***************************************************************************
+ * Function: ~SmallVector
+ * Description:
+ *      Destroys the live elements and frees the heap buffer if we have one.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+SmallVector<DATA, N>::~SmallVector()
+{
+    release();
+}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The copy assignment operator. Reuses our storage when it's big enough.
+ * Parameters:
+ *      const SmallVector &objectToCopy : SmallVector to copy from
+ * Return:
+ *      SmallVector& : this
+***************************************************************************/
+template <typename DATA, size_t N>
+SmallVector<DATA, N>& SmallVector<DATA, N>::operator=(const SmallVector& objectToCopy)
+{
+    if(&objectToCopy == this)
+        return *this;
+
+    clear();
+    reserve(objectToCopy.size_);
+
+    for(; size_ < objectToCopy.size_; size_++)
+        ::new (static_cast<void*>(array_ + size_)) DATA(objectToCopy.array_[size_]);
+
+    return *this;
+}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The move assignment operator. Steals a heap buffer, or moves inline
+ *      elements across, leaving the other SmallVector empty.
+ * Parameters:
+ *      SmallVector&& objectToMove : SmallVector to move contents from
+ * Return:
+ *      SmallVector& : this
+***************************************************************************/
+template <typename DATA, size_t N>
+SmallVector<DATA, N>& SmallVector<DATA, N>::operator=(SmallVector&& objectToMove) noexcept(std::is_nothrow_move_constructible<DATA>::value)
+{
+    if(&objectToMove == this)
+        return *this;
+
+    release();
+
+    if(objectToMove.isInline())
+    {
+        relocate(objectToMove.array_, objectToMove.size_, array_);
+        size_ = objectToMove.size_;
+        objectToMove.clear();
+    }
+    else
+    {
+        array_    = objectToMove.array_;
+        capacity_ = objectToMove.capacity_;
+        size_     = objectToMove.size_;
+
+        objectToMove.array_    = objectToMove.inlineBuffer();
+        objectToMove.capacity_ = N;
+        objectToMove.size_     = 0;
+    }
+
+    return *this;
+}
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                       */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Pushes a copy of an element into the back of the vector.
+ * Parameters:
+ *      const DATA& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::push_back(const DATA& inputData)
+{
+    emplace_back(inputData);
+}
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Moves an element into the back of the vector.
+ * Parameters:
+ *      DATA&& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::push_back(DATA&& inputData)
+{
+    emplace_back(std::move(inputData));
+}
+
+/***************************************************************************
+ * Function: emplace_back
+ * Description:
+ *      Constructs a new element directly in the back of the vector, out of
+ *      the given constructor arguments. No temporary is made, also not when
+ *      the vector is full.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA, size_t N>
+template <typename... ARGS>
+DATA& SmallVector<DATA, N>::emplace_back(ARGS&&... args)
+{
+    if(size_ < capacity_)
+    {
+        ::new (static_cast<void*>(array_ + size_)) DATA(std::forward<ARGS>(args)...);
+        return array_[size_++];
+    }
+
+    // We're full, so the next buffer is on the heap. The arguments may refer
+    // to one of our own elements (inline or on the heap), so the new element
+    // is built in the new buffer before the old one is let go.
+    size_t newCapacity = capacity_ * 2;
+    DATA* tempArr = std::allocator<DATA>().allocate(newCapacity);
+    try
+    {
+        ::new (static_cast<void*>(tempArr + size_)) DATA(std::forward<ARGS>(args)...);
+    }
+    catch(...)
+    {
+        std::allocator<DATA>().deallocate(tempArr, newCapacity);
+        throw;
+    }
+
+    try
+    {
+        relocate(array_, size_, tempArr);
+    }
+    catch(...)
+    {
+        tempArr[size_].~DATA();
+        std::allocator<DATA>().deallocate(tempArr, newCapacity);
+        throw;
+    }
+
+    std::destroy(array_, array_ + size_);
+    if(!isInline())
+        std::allocator<DATA>().deallocate(array_, capacity_);
+    array_    = tempArr;
+    capacity_ = newCapacity;
+
+    return array_[size_++];
+}
+
+/***************************************************************************
+ * Function: insertAt
+ * Description:
+ *      Inserts a copy of an element at a specific location in the vector,
+ *      pushing the current contents back to make space.
+ * Parameters:
+ *      size_t      index     : The location to insert the new element
+ *      const DATA& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::insertAt(size_t index, const DATA& inputData)
+{
+    insertAt(index, DATA(inputData));
+}
+
+/***************************************************************************
+ * Function: insertAt
+ * Description:
+ *      Moves an element into a specific location in the vector, pushing the
+ *      current contents back to make space.
+ * Parameters:
+ *      size_t index     : The location to insert the new element
+ *      DATA&& inputData : The desired element to be placed into the vector
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::insertAt(size_t index, DATA&& inputData)
+{
+    // Check to see if the index is valid
+    if(index > size_)
+        throw std::out_of_range("Not a valid Index to Insert.");
+
+    if(index == size_)
+    {
+        push_back(std::move(inputData));
+        return;
+    }
+
+    // Resize the vector if necessary
+    if(size_ == capacity_)
+        resize();
+
+    if constexpr(TRIVIAL)
+    {
+        std::memmove(array_ + index + 1, array_ + index, (size_ - index) * sizeof(DATA));
+        ::new (static_cast<void*>(array_ + index)) DATA(std::move(inputData));
+        size_++;
+        return;
+    }
+
+    // The last element moves into uninitialized storage, so it has to be constructed
+    ::new (static_cast<void*>(array_ + size_)) DATA(std::move(array_[size_ - 1]));
+    size_++;
+
+    // Push the rest of the contents back to make space
+    for(auto i = size_ - 2; i > index; i--)
+        array_[i] = std::move(array_[i - 1]);
+
+    // Finally, insert the value at the desired index
+    array_[index] = std::move(inputData);
+}
+
+/***************************************************************************
+ * Function: insert
+ * Description:
+ *      Inserts the elements [first, last) before position index, in order.
+ *      The vector grows at most once and the tail is shifted once by the
+ *      whole count. The range must not point into this vector. Single pass
+ *      (input) iterators are appended at the back and then rotated into
+ *      place instead.
+ * Parameters:
+ *      size_t index : The location to insert the new elements (0 : size())
+ *      ITER   first : Start of the elements to insert
+ *      ITER   last  : One past the end of the elements to insert
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+template <typename ITER>
+void SmallVector<DATA, N>::insert(size_t index, ITER first, ITER last)
+{
+    // Check to see if the index is valid
+    if(index > size_)
+        throw std::out_of_range("Not a valid Index to Insert.");
+
+    using CATEGORY = typename std::iterator_traits<ITER>::iterator_category;
+    if constexpr(!std::is_base_of<std::forward_iterator_tag, CATEGORY>::value)
+    {
+        // We can't count the elements up front, so add them to the back and
+        // spin them around into position.
+        size_t oldSize = size_;
+        for(; first != last; ++first)
+            emplace_back(*first);
+        std::rotate(array_ + index, array_ + oldSize, array_ + size_);
+    }
+    else
+    {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if(count == 0)
+            return;
+
+        if(size_ + count > capacity_)
+            reallocate(std::max(capacity_ * 2, size_ + count));
+
+        size_t tail = size_ - index;
+        if constexpr(TRIVIAL)
+        {
+            // Open the gap with a single memmove and copy the range in
+            std::memmove(array_ + index + count, array_ + index, tail * sizeof(DATA));
+            for(DATA* slot = array_ + index; first != last; ++first, ++slot)
+                ::new (static_cast<void*>(slot)) DATA(*first);
+            size_ += count;
+            return;
+        }
+
+        DATA* oldEnd = array_ + size_;
+        if(count <= tail)
+        {
+            // The last 'count' elements move into uninitialized storage, the
+            // rest of the tail is shifted over live elements.
+            std::uninitialized_move(oldEnd - count, oldEnd, oldEnd);
+            size_ += count;
+            std::move_backward(array_ + index, oldEnd - count, oldEnd);
+            std::copy(first, last, array_ + index);
+        }
+        else
+        {
+            // The range reaches past the old end: the part of it that lands
+            // there is constructed, and the tail moves right behind it.
+            ITER middle = first;
+            std::advance(middle, tail);
+            std::uninitialized_copy(middle, last, oldEnd);
+            size_ += count - tail;
+            std::uninitialized_move(array_ + index, oldEnd, array_ + index + count);
+            size_ += tail;
+            std::copy(first, middle, array_ + index);
+        }
+    }
+}
+
+/***************************************************************************
+ * Function: append
+ * Description:
+ *      Adds every element of a range (anything with begin() and end()) to
+ *      the back of the vector, growing at most once.
+ * Parameters:
+ *      const RANGE& range : The elements to add
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+template <typename RANGE>
+void SmallVector<DATA, N>::append(const RANGE& range)
+{
+    insert(size_, std::begin(range), std::end(range));
+}
+
+/***************************************************************************
+ * Function: erase
+ * Description:
+ *      Removes the elements in the index range [first, last). Everything
+ *      after them is shifted down once. The storage is kept.
+ * Parameters:
+ *      size_t first : Index of the first element to remove
+ *      size_t last  : Index one past the last element to remove
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::erase(size_t first, size_t last)
+{
+    if(first > last || last > size_)
+        throw std::out_of_range("Not a valid range to Erase.");
+
+    if(first == last)
+        return;
+
+    if constexpr(TRIVIAL)
+    {
+        std::memmove(array_ + first, array_ + last, (size_ - last) * sizeof(DATA));
+        size_ -= last - first;
+        return;
+    }
+
+    DATA* newEnd = std::move(array_ + last, array_ + size_, array_ + first);
+    std::destroy(newEnd, array_ + size_);
+    size_ = newEnd - array_;
+}
+
+/***************************************************************************
+ * Function: erase_if
+ * Description:
+ *      Removes every element the predicate returns true for, keeping the
+ *      order of the rest. Done in a single compaction pass.
+ * Parameters:
+ *      PREDICATE pred : Called with each element, true = remove it
+ * Return:
+ *      size_t : The number of elements removed
+***************************************************************************/
+template <typename DATA, size_t N>
+template <typename PREDICATE>
+size_t SmallVector<DATA, N>::erase_if(PREDICATE pred)
+{
+    DATA* newEnd = std::remove_if(array_, array_ + size_, pred);
+    size_t removed = (array_ + size_) - newEnd;
+
+    std::destroy(newEnd, array_ + size_);
+    size_ -= removed;
+
+    return removed;
+}
+
+/***************************************************************************
+ * Function: pop_back
+ * Description:
+ *      Removes the element at the back of the vector.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::pop_back()
+{
+    size_--;
+    array_[size_].~DATA();
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Removes every element, but keeps the current storage.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::clear()
+{
+    std::destroy(array_, array_ + size_);
+    size_ = 0;
+}
+
+/***************************************************************************
+ * Function: reserve
+ * Description:
+ *      Makes sure the vector can hold at least newCapacity elements without
+ *      having to grow again. Never shrinks the vector.
+ * Parameters:
+ *      size_t newCapacity : The minimum capacity wanted
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::reserve(size_t newCapacity)
+{
+    if(newCapacity > capacity_)
+        reallocate(newCapacity);
+}
+
+/***************************************************************************
+ * Function: shrink_to_fit
+ * Description:
+ *      Gives back unused heap capacity. If the elements fit inline again,
+ *      they move back into the inline buffer and the heap buffer is freed.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::shrink_to_fit()
+{
+    if(!isInline() && size_ < capacity_)
+        reallocate(size_);
+}
+/*====================================================================================================================*/
+/* END OF MODIFIERS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: front
+ * Description:
+ *      Returns the value at the front of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The front element in the vector
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA const& SmallVector<DATA, N>::front()
+{
+    return array_[0];
+}
+
+/***************************************************************************
+ * Function: back
+ * Description:
+ *      Returns the value at the back of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA : The back element in the vector
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA const& SmallVector<DATA, N>::back()
+{
+    return array_[size_ - 1];
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the current size of the vector
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The size of the vector
+***************************************************************************/
+template <typename DATA, size_t N>
+size_t const& SmallVector<DATA, N>::size() const
+{
+    return size_;
+}
+
+/***************************************************************************
+ * Function: capacity
+ * Description:
+ *      Returns the total capacity of the vector (at least N)
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The capacity of the vector
+***************************************************************************/
+template <typename DATA, size_t N>
+size_t const& SmallVector<DATA, N>::capacity() const
+{
+    return capacity_;
+}
+
+/***************************************************************************
+ * Function: empty
+ * Description:
+ *      Returns whether or not the vector is empty
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true = vector is empty, false = vector is not empty
+***************************************************************************/
+template <typename DATA, size_t N>
+bool SmallVector<DATA, N>::empty() const
+{
+    return size_ == 0;
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Returns the element at the given index. The index is not checked,
+ *      use at() for that.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA& SmallVector<DATA, N>::operator[](size_t index)
+{
+    return array_[index];
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Read only version of operator[] for const SmallVectors.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA const& SmallVector<DATA, N>::operator[](size_t index) const
+{
+    return array_[index];
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Returns the element at the given index, after checking that it's in
+ *      range.
+ * Parameters:
+ *      size_t index : position of the element
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA& SmallVector<DATA, N>::at(size_t index)
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return array_[index];
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Read only version of at() for const SmallVectors.
+ * Parameters:
+ *      size_t index : position of the element
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA const& SmallVector<DATA, N>::at(size_t index) const
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return array_[index];
+}
+
+/***************************************************************************
+ * Function: data
+ * Description:
+ *      Returns a pointer to the first element, in the inline buffer or on
+ *      the heap. It changes when the elements move between the two.
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA* : pointer to the first element
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA* SmallVector<DATA, N>::data()
+{
+    return array_;
+}
+
+/***************************************************************************
+ * Function: data
+ * Description:
+ *      Read only version of data() for const SmallVectors.
+ * Parameters:
+ *      None
+ * Return:
+ *      const DATA* : pointer to the first element
+***************************************************************************/
+template <typename DATA, size_t N>
+const DATA* SmallVector<DATA, N>::data() const
+{
+    return array_;
+}
+
+/***************************************************************************
+ * Function: isInline
+ * Description:
+ *      Returns whether the elements are still stored inside the object.
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true = no heap buffer in use
+***************************************************************************/
+template <typename DATA, size_t N>
+bool SmallVector<DATA, N>::isInline() const
+{
+    return array_ == reinterpret_cast<const DATA*>(inline_);
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ITERATORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: begin
+ * Description:
+ *      Returns an iterator to the first element.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : the first element
+***************************************************************************/
+template <typename DATA, size_t N>
+typename SmallVector<DATA, N>::iterator SmallVector<DATA, N>::begin()
+{
+    return array_;
+}
+
+/***************************************************************************
+ * Function: end
+ * Description:
+ *      Returns an iterator one past the last element.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : one past the last element
+***************************************************************************/
+template <typename DATA, size_t N>
+typename SmallVector<DATA, N>::iterator SmallVector<DATA, N>::end()
+{
+    return array_ + size_;
+}
+
+/***************************************************************************
+ * Function: begin
+ * Description:
+ *      Read only version of begin() for const SmallVectors.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : the first element
+***************************************************************************/
+template <typename DATA, size_t N>
+typename SmallVector<DATA, N>::const_iterator SmallVector<DATA, N>::begin() const
+{
+    return array_;
+}
+
+/***************************************************************************
+ * Function: end
+ * Description:
+ *      Read only version of end() for const SmallVectors.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : one past the last element
+***************************************************************************/
+template <typename DATA, size_t N>
+typename SmallVector<DATA, N>::const_iterator SmallVector<DATA, N>::end() const
+{
+    return array_ + size_;
+}
+
+/***************************************************************************
+ * Function: cbegin
+ * Description:
+ *      Returns a read only iterator to the first element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : the first element
+***************************************************************************/
+template <typename DATA, size_t N>
+typename SmallVector<DATA, N>::const_iterator SmallVector<DATA, N>::cbegin() const
+{
+    return array_;
+}
+
+/***************************************************************************
+ * Function: cend
+ * Description:
+ *      Returns a read only iterator one past the last element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : one past the last element
+***************************************************************************/
+template <typename DATA, size_t N>
+typename SmallVector<DATA, N>::const_iterator SmallVector<DATA, N>::cend() const
+{
+    return array_ + size_;
+}
+
+/*====================================================================================================================*/
+/* END OF ITERATORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: resize
+ * Description:
+ *      Doubles the capacity of the vector, moving it onto the heap.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::resize()
+{
+    reallocate(capacity_ * 2);
+}
+
+/***************************************************************************
+ * Function: reallocate
+ * Description:
+ *      Moves the elements into a buffer with the given capacity. Anything
+ *      that fits in N goes back to the inline buffer, the rest goes to a
+ *      new heap buffer.
+ * Parameters:
+ *      size_t newCapacity : capacity wanted (must be >= size_)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::reallocate(size_t newCapacity)
+{
+    DATA* tempArr = inlineBuffer();
+    if(newCapacity > N)
+        tempArr = std::allocator<DATA>().allocate(newCapacity);
+    else
+        newCapacity = N;
+
+    if(tempArr == array_)
+        return;
+
+    try
+    {
+        relocate(array_, size_, tempArr);
+    }
+    catch(...)
+    {
+        if(tempArr != inlineBuffer())
+            std::allocator<DATA>().deallocate(tempArr, newCapacity);
+        throw;
+    }
+
+    std::destroy(array_, array_ + size_);
+    if(!isInline())
+        std::allocator<DATA>().deallocate(array_, capacity_);
+
+    array_    = tempArr;
+    capacity_ = newCapacity;
+}
+
+/***************************************************************************
+ * Function: relocate
+ * Description:
+ *      Constructs count elements in the raw storage 'to' out of the ones in
+ *      'from', moving if that can't throw. The source is not destroyed.
+ * Parameters:
+ *      DATA*  from  : the live elements to relocate
+ *      size_t count : number of elements
+ *      DATA*  to    : uninitialized destination storage
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::relocate(DATA* from, size_t count, DATA* to)
+{
+    if constexpr(TRIVIAL)
+    {
+        if(count)
+            std::memcpy(to, from, count * sizeof(DATA));
+        return;
+    }
+
+    size_t index = 0;
+    try
+    {
+        for(; index < count; index++)
+            ::new (static_cast<void*>(to + index)) DATA(std::move_if_noexcept(from[index]));
+    }
+    catch(...)
+    {
+        std::destroy(to, to + index);
+        throw;
+    }
+}
+
+/***************************************************************************
+ * Function: inlineBuffer
+ * Description:
+ *      Returns the inline storage as a pointer to DATA.
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA* : start of the inline buffer
+***************************************************************************/
+template <typename DATA, size_t N>
+DATA* SmallVector<DATA, N>::inlineBuffer()
+{
+    return std::launder(reinterpret_cast<DATA*>(inline_));
+}
+
+/***************************************************************************
+ * Function: release
+ * Description:
+ *      Destroys every element and frees the heap buffer, leaving an empty
+ *      vector on its inline buffer.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::release()
+{
+    std::destroy(array_, array_ + size_);
+    if(!isInline())
+        std::allocator<DATA>().deallocate(array_, capacity_);
+
+    array_    = inlineBuffer();
+    capacity_ = N;
+    size_     = 0;
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* EXTRA FUNCTIONS USED FOR TESTING/DEBUGGING                                                                         */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: displayVector
+ * Description:
+ *      Prints out the contents of the vector to the console.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t N>
+void SmallVector<DATA, N>::displayVector()
+{
+    for(size_t index = 0; index < size_; index++)
+        std::cout << array_[index] << " ";
+
+    std::cout << std::endl;
+}
+/*====================================================================================================================*/
+/* END OF EXTRA FUNCTIONS                                                                                          */
+/*====================================================================================================================*/
+#endif //SMALL_VECTOR_H
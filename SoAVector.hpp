@@ -0,0 +1,654 @@
+/*************************************************************************************************
+* File: SoAVector.hpp
+* Description:
+*       A "structure of arrays" Vector. Instead of storing whole records one after the other,
+*       like Vector<Record> does, SoAVector<int, double, char> stores every field in its own
+*       Vector (a column). Row i is made of the i-th element of every column.
+*
+*       A loop that only reads one field of every record then walks a single contiguous array,
+*       so every cache line it loads is full of useful data, and the compiler (or the functions
+*       in Vector-SIMD.hpp) can vectorize it. The price is that reading a whole record touches
+*       one cache line per field.
+*
+*       push_back/pop_back/front/back/size work like in Vector, except that a record is passed
+*       as one argument per field, and returned as a std::tuple of references. column<I>()
+*       gives read only access to a whole column, columnView<I>() the same as a plain
+*       (pointer, size) pair, and columnData<I>() a pointer to change it.
+*       Fields can't be bool: a bool column would be a Vector<bool>, whose flags are bits.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the idea, refer to the following:
+*       Link: https://en.wikipedia.org/wiki/AoS_and_SoA
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef SOA_VECTOR_H
+#define SOA_VECTOR_H
+
+#include "Vector.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <memory_resource>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+template<typename... FIELDS>
+class SoAVector
+{
+    static_assert(sizeof...(FIELDS) > 0, "SoAVector needs at least one field");
+    static_assert(!(std::is_same<FIELDS, bool>::value || ...),
+                  "SoAVector can't have bool fields, Vector<bool> packs them into bits so there's no bool& to hand out. Use char or uint8_t");
+
+    public:
+        // The type of the I-th field
+        template <size_t I>
+        using Field = std::tuple_element_t<I, std::tuple<FIELDS...>>;
+
+        // A whole record, returned as references into the columns
+        using reference       = std::tuple<FIELDS&...>;
+        using const_reference = std::tuple<const FIELDS&...>;
+
+        // Default Constructor
+        SoAVector() = default;
+        // Constructor that takes the memory of every column from the given resource
+        SoAVector(std::pmr::memory_resource* resource);
+        // Copy and move are done column by column by Vector itself
+
+        // Mutators
+        void push_back(const FIELDS&... fields);
+        void push_back(FIELDS&&... fields);
+        void pop_back();
+        void clear();
+        void reserve(size_t newCapacity);
+        void shrink_to_fit();
+
+        // Accessors
+        const_reference front();
+        const_reference back();
+        size_t size() const;
+        size_t capacity() const;
+        bool empty() const;
+        reference operator[](size_t index);
+        const_reference operator[](size_t index) const;
+        reference at(size_t index);
+        // A single field of a single row
+        template <size_t I>
+        Field<I>& get(size_t index);
+
+        // Whole columns
+        template <size_t I>
+        const Vector<Field<I>>& column() const;
+        template <size_t I>
+        Field<I>* columnData();
+        template <size_t I>
+        std::pair<const Field<I>*, size_t> columnView() const;
+        #if __cplusplus >= 202002L
+        template <size_t I>
+        std::span<Field<I>> columnSpan();
+        #endif
+
+        // Used for testing purposes
+        void displayVector();
+
+    private:
+        // One Vector per field, all of them always the same size
+        std::tuple<Vector<FIELDS>...> columns_;
+
+        using Indices = std::index_sequence_for<FIELDS...>;
+
+        // Makes sure every column has room for one more element
+        void makeRoom();
+        // Pushes one element on every column, undoing the pushes if one throws
+        template <size_t... I, typename... ARGS>
+        void pushColumns(std::index_sequence<I...>, ARGS&&... fields);
+        template <size_t... I>
+        void popColumns(std::index_sequence<I...>, size_t count);
+        template <size_t... I>
+        reference row(std::index_sequence<I...>, size_t index);
+        template <size_t... I>
+        const_reference row(std::index_sequence<I...>, size_t index) const;
+        template <size_t... I>
+        size_t minCapacity(std::index_sequence<I...>) const;
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS                                                                                                       */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: SoAVector
+ * Description:
+ *      Creates an empty SoAVector whose columns all allocate from the given
+ *      memory resource.
+ * Parameters:
+ *      std::pmr::memory_resource* resource : where the columns get memory
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+SoAVector<FIELDS...>::SoAVector(std::pmr::memory_resource* resource) :
+columns_(Vector<FIELDS>(resource)...) {}
+
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS                                                                                                */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Adds a record at the back, copying each field into its column.
+ *      If the columns have to grow, the fields are copied first, in case
+ *      they refer to elements of this SoAVector.
+ * Parameters:
+ *      const FIELDS&... fields : one value per field
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::push_back(const FIELDS&... fields)
+{
+    if(size() == minCapacity(Indices()))
+    {
+        std::tuple<FIELDS...> record(fields...);
+        makeRoom();
+        std::apply([this](FIELDS&... copies) { pushColumns(Indices(), std::move(copies)...); }, record);
+    }
+    else
+    {
+        pushColumns(Indices(), fields...);
+    }
+}
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Adds a record at the back, moving each field into its column.
+ * Parameters:
+ *      FIELDS&&... fields : one value per field
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::push_back(FIELDS&&... fields)
+{
+    if(size() == minCapacity(Indices()))
+    {
+        std::tuple<FIELDS...> record(std::move(fields)...);
+        makeRoom();
+        std::apply([this](FIELDS&... copies) { pushColumns(Indices(), std::move(copies)...); }, record);
+    }
+    else
+    {
+        pushColumns(Indices(), std::move(fields)...);
+    }
+}
+
+/***************************************************************************
+ * Function: pop_back
+ * Description:
+ *      Removes the last record from every column.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::pop_back()
+{
+    popColumns(Indices(), sizeof...(FIELDS));
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Removes every record. The capacity is kept.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::clear()
+{
+    std::apply([](Vector<FIELDS>&... columns) { (columns.clear(), ...); }, columns_);
+}
+
+/***************************************************************************
+ * Function: reserve
+ * Description:
+ *      Makes room for at least newCapacity records in every column.
+ * Parameters:
+ *      size_t newCapacity : number of records to make room for
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::reserve(size_t newCapacity)
+{
+    std::apply([newCapacity](Vector<FIELDS>&... columns) { (columns.reserve(newCapacity), ...); }, columns_);
+}
+
+/***************************************************************************
+ * Function: shrink_to_fit
+ * Description:
+ *      Gives back the unused capacity of every column.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::shrink_to_fit()
+{
+    std::apply([](Vector<FIELDS>&... columns) { (columns.shrink_to_fit(), ...); }, columns_);
+}
+
+/*====================================================================================================================*/
+/* END OF MUTATORS                                                                                                    */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: front
+ * Description:
+ *      Returns the first record
+ * Parameters:
+ *      None
+ * Return:
+ *      const_reference : references to every field of the first record
+***************************************************************************/
+template <typename... FIELDS>
+typename SoAVector<FIELDS...>::const_reference SoAVector<FIELDS...>::front()
+{
+    return row(Indices(), 0);
+}
+
+/***************************************************************************
+ * Function: back
+ * Description:
+ *      Returns the last record
+ * Parameters:
+ *      None
+ * Return:
+ *      const_reference : references to every field of the last record
+***************************************************************************/
+template <typename... FIELDS>
+typename SoAVector<FIELDS...>::const_reference SoAVector<FIELDS...>::back()
+{
+    return row(Indices(), size() - 1);
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the number of records
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The number of records
+***************************************************************************/
+template <typename... FIELDS>
+size_t SoAVector<FIELDS...>::size() const
+{
+    return std::get<0>(columns_).size();
+}
+
+/***************************************************************************
+ * Function: capacity
+ * Description:
+ *      Returns how many records fit before some column has to grow
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The capacity
+***************************************************************************/
+template <typename... FIELDS>
+size_t SoAVector<FIELDS...>::capacity() const
+{
+    return minCapacity(Indices());
+}
+
+/***************************************************************************
+ * Function: empty
+ * Description:
+ *      Returns whether or not there are no records
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true = empty, false = not empty
+***************************************************************************/
+template <typename... FIELDS>
+bool SoAVector<FIELDS...>::empty() const
+{
+    return size() == 0;
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Returns the record at the given index. The index is not checked.
+ * Parameters:
+ *      size_t index : position of the record, must be < size()
+ * Return:
+ *      reference : references to every field of the record
+***************************************************************************/
+template <typename... FIELDS>
+typename SoAVector<FIELDS...>::reference SoAVector<FIELDS...>::operator[](size_t index)
+{
+    return row(Indices(), index);
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Read only version of operator[] for const SoAVectors.
+ * Parameters:
+ *      size_t index : position of the record, must be < size()
+ * Return:
+ *      const_reference : references to every field of the record
+***************************************************************************/
+template <typename... FIELDS>
+typename SoAVector<FIELDS...>::const_reference SoAVector<FIELDS...>::operator[](size_t index) const
+{
+    return row(Indices(), index);
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Returns the record at the given index, after checking that it's in
+ *      range.
+ * Parameters:
+ *      size_t index : position of the record
+ * Return:
+ *      reference : references to every field of the record
+***************************************************************************/
+template <typename... FIELDS>
+typename SoAVector<FIELDS...>::reference SoAVector<FIELDS...>::at(size_t index)
+{
+    if(index >= size())
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return row(Indices(), index);
+}
+
+/***************************************************************************
+ * Function: get
+ * Description:
+ *      Returns one field of one record, without touching the other columns.
+ *      The index is not checked.
+ * Parameters:
+ *      size_t index : position of the record, must be < size()
+ * Return:
+ *      Field<I>& : the I-th field of the record
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t I>
+auto SoAVector<FIELDS...>::get(size_t index) -> Field<I>&
+{
+    return std::get<I>(columns_)[index];
+}
+
+/***************************************************************************
+ * Function: column
+ * Description:
+ *      Returns the whole I-th column as a read only Vector, so it can be
+ *      handed to anything that scans a Vector (e.g. sum() or find() from
+ *      Vector-SIMD.hpp, or a std::span in C++ 20).
+ * Parameters:
+ *      None
+ * Return:
+ *      const Vector<Field<I>>& : the column
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t I>
+auto SoAVector<FIELDS...>::column() const -> const Vector<Field<I>>&
+{
+    return std::get<I>(columns_);
+}
+
+/***************************************************************************
+ * Function: columnData
+ * Description:
+ *      Returns a pointer to the first element of the I-th column. The
+ *      elements [0, size()) can be changed through it. It stays valid until
+ *      the next push_back, reserve or shrink_to_fit.
+ * Parameters:
+ *      None
+ * Return:
+ *      Field<I>* : the start of the column
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t I>
+auto SoAVector<FIELDS...>::columnData() -> Field<I>*
+{
+    return std::get<I>(columns_).data();
+}
+
+/***************************************************************************
+ * Function: columnView
+ * Description:
+ *      Returns the I-th column as a read only (pointer, size) pair, for code
+ *      that scans raw arrays. Works in C++ 17, where columnSpan isn't there.
+ *      The pointer stays valid until the next push_back, reserve or
+ *      shrink_to_fit.
+ * Parameters:
+ *      None
+ * Return:
+ *      std::pair<const Field<I>*, size_t> : the start of the column and the
+ *                                           number of records
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t I>
+auto SoAVector<FIELDS...>::columnView() const -> std::pair<const Field<I>*, size_t>
+{
+    const Vector<Field<I>>& column = std::get<I>(columns_);
+    return {column.data(), column.size()};
+}
+
+#if __cplusplus >= 202002L
+/***************************************************************************
+ * Function: columnSpan
+ * Description:
+ *      Returns the I-th column as a span over its live elements.
+ * Parameters:
+ *      None
+ * Return:
+ *      std::span<Field<I>> : the column
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t I>
+auto SoAVector<FIELDS...>::columnSpan() -> std::span<Field<I>>
+{
+    return std::get<I>(columns_);
+}
+#endif
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: makeRoom
+ * Description:
+ *      Grows every column to the same, doubled capacity. Growing them all
+ *      together means a push_back either fails before touching any column,
+ *      or only has to worry about the element copies throwing.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::makeRoom()
+{
+    reserve(DoublingGrowth::grow(minCapacity(Indices()), 0));
+}
+
+/***************************************************************************
+ * Function: pushColumns
+ * Description:
+ *      Pushes fields[I] onto column I, for every I. If one of the pushes
+ *      throws, the ones already done are popped again, so the columns
+ *      never end up with different sizes.
+ * Parameters:
+ *      std::index_sequence<I...> : 0 .. number of fields - 1
+ *      ARGS&&... fields          : one value per field
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t... I, typename... ARGS>
+void SoAVector<FIELDS...>::pushColumns(std::index_sequence<I...>, ARGS&&... fields)
+{
+    size_t pushed = 0;
+    try
+    {
+        ((std::get<I>(columns_).push_back(std::forward<ARGS>(fields)), pushed++), ...);
+    }
+    catch(...)
+    {
+        popColumns(Indices(), pushed);
+        throw;
+    }
+}
+
+/***************************************************************************
+ * Function: popColumns
+ * Description:
+ *      Pops the last element of the first count columns.
+ * Parameters:
+ *      std::index_sequence<I...> : 0 .. number of fields - 1
+ *      size_t count              : how many columns to pop
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t... I>
+void SoAVector<FIELDS...>::popColumns(std::index_sequence<I...>, size_t count)
+{
+    ((I < count ? std::get<I>(columns_).pop_back() : void()), ...);
+}
+
+/***************************************************************************
+ * Function: row
+ * Description:
+ *      Gathers references to the index-th element of every column.
+ * Parameters:
+ *      std::index_sequence<I...> : 0 .. number of fields - 1
+ *      size_t index              : position of the record
+ * Return:
+ *      reference : references to every field of the record
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t... I>
+typename SoAVector<FIELDS...>::reference SoAVector<FIELDS...>::row(std::index_sequence<I...>, size_t index)
+{
+    return reference(std::get<I>(columns_)[index]...);
+}
+
+/***************************************************************************
+ * Function: row
+ * Description:
+ *      Read only version of row.
+ * Parameters:
+ *      std::index_sequence<I...> : 0 .. number of fields - 1
+ *      size_t index              : position of the record
+ * Return:
+ *      const_reference : references to every field of the record
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t... I>
+typename SoAVector<FIELDS...>::const_reference SoAVector<FIELDS...>::row(std::index_sequence<I...>, size_t index) const
+{
+    return const_reference(std::get<I>(columns_)[index]...);
+}
+
+/***************************************************************************
+ * Function: minCapacity
+ * Description:
+ *      Returns the smallest capacity of all the columns. They usually agree,
+ *      but a copied column only gets as much room as it needs.
+ * Parameters:
+ *      std::index_sequence<I...> : 0 .. number of fields - 1
+ * Return:
+ *      size_t : the smallest capacity
+***************************************************************************/
+template <typename... FIELDS>
+template <size_t... I>
+size_t SoAVector<FIELDS...>::minCapacity(std::index_sequence<I...>) const
+{
+    return std::min({std::get<I>(columns_).capacity()...});
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* EXTRA FUNCTIONS USED FOR TESTING/DEBUGGING                                                                         */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: displayVector
+ * Description:
+ *      Prints out every record to the console, one per line.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename... FIELDS>
+void SoAVector<FIELDS...>::displayVector()
+{
+    for(size_t index = 0; index < size(); index++)
+    {
+        std::apply([](const FIELDS&... fields) { ((std::cout << fields << " "), ...); }, (*this)[index]);
+        std::cout << std::endl;
+    }
+}
+/*====================================================================================================================*/
+/* END OF EXTRA FUNCTIONS                                                                                          */
+/*====================================================================================================================*/
+#endif //SOA_VECTOR_H
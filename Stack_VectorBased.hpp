@@ -24,18 +24,26 @@ class Stack
 
         // Constructors, Rule of Three
         Stack() = default;
+        Stack(std::pmr::memory_resource* resource);
         ~Stack();
         Stack(const Stack&);
         void operator=(const Stack&);
 
         // Mutators
-        void push(DATA);
+        void push(const DATA&);
+        void push(DATA&&);
+        template <typename... ARGS>
+        void emplace(ARGS&&...);
         void pop();
 
         // Accessors
         bool empty();
         size_t size();
-        DATA top();
+        typename Vector<DATA>::const_reference top();
+
+        // Binary save/load, see Serialization.hpp for the format
+        void save(std::ostream&) const;
+        void load(std::istream&);
 
     private:
         Vector<DATA> container_; // Underlying container that data will be held in
@@ -67,6 +75,19 @@ class Stack
 template <typename DATA>
 Stack<DATA>::~Stack() {}
 
+/*************************************************************************** 
+ * Function: Stack
+ * Description:
+ *      Creates an empty Stack whose container allocates from the given
+ *      memory resource.
+ * Parameters:
+ *      std::pmr::memory_resource* resource : where to allocate from
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+Stack<DATA>::Stack(std::pmr::memory_resource* resource) : container_(resource) {}
+
 /*************************************************************************** 
  * Function: Stack
  * Description:
@@ -109,18 +130,49 @@ void Stack<DATA>::operator=(const Stack& rhs)
 /*************************************************************************** 
  * Function: push
  * Description:
- *      push a the desired element onto the top of the Stack
+ *      push a copy of the desired element onto the top of the Stack
  * Parameters:
- *      DATA element : The desired element to be inserted into the stack.
+ *      const DATA& element : The desired element to be inserted into the stack.
  * Return:
  *      None 
 ***************************************************************************/
 template <typename DATA>
-void Stack<DATA>::push(DATA element)
+void Stack<DATA>::push(const DATA& element)
 {
     container_.push_back(element);
 }
 
+/*************************************************************************** 
+ * Function: push
+ * Description:
+ *      move the desired element onto the top of the Stack
+ * Parameters:
+ *      DATA&& element : The desired element to be inserted into the stack.
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void Stack<DATA>::push(DATA&& element)
+{
+    container_.push_back(std::move(element));
+}
+
+/*************************************************************************** 
+ * Function: emplace
+ * Description:
+ *      construct a new element in place on the top of the Stack
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+template <typename... ARGS>
+void Stack<DATA>::emplace(ARGS&&... args)
+{
+    container_.emplace_back(std::forward<ARGS>(args)...);
+}
+
 /*************************************************************************** 
  * Function: pop
  * Description:
@@ -184,10 +236,11 @@ size_t Stack<DATA>::size()
  * Parameters:
  *      None
  * Return:
- *      DATA : the element residing on the top of the stack. 
+ *      DATA const& : the element residing on the top of the stack (a plain
+ *                    bool for Stack<bool>, see Vector-Bool.hpp). 
 ***************************************************************************/
 template <typename DATA>
-DATA Stack<DATA>::top()
+typename Vector<DATA>::const_reference Stack<DATA>::top()
 {
     return container_.back();
 }
@@ -196,4 +249,44 @@ DATA Stack<DATA>::top()
 /* END OF ACCESSORS                                                                                                   */
 /*====================================================================================================================*/
 
+
+/*====================================================================================================================*/
+/* SERIALIZATION                                                                                                      */
+/*====================================================================================================================*/
+
+/*************************************************************************** 
+ * Function: save
+ * Description:
+ *      Writes the stack to a binary stream, bottom first. Same format as the
+ *      underlying Vector.
+ * Parameters:
+ *      std::ostream& out : stream to write to
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void Stack<DATA>::save(std::ostream& out) const
+{
+    container_.save(out);
+}
+
+/*************************************************************************** 
+ * Function: load
+ * Description:
+ *      Replaces the contents of the stack with a stack written by save().
+ * Parameters:
+ *      std::istream& in : stream to read from
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA>
+void Stack<DATA>::load(std::istream& in)
+{
+    container_.load(in);
+}
+
+/*====================================================================================================================*/
+/* END OF SERIALIZATION                                                                                               */
+/*====================================================================================================================*/
+
 #endif // STACK_VECTORBASED_H
\ No newline at end of file
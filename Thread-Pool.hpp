@@ -0,0 +1,393 @@
+/*************************************************************************************************
+* File: Thread-Pool.hpp
+* Description:
+*       A small work stealing thread pool, used by the parallel algorithms in Vector-Parallel.hpp.
+*
+*       ThreadPool : Every thread owns a deque of tasks. A thread pushes and pops at the back of
+*                    its own deque (newest first, which keeps the data it just touched in
+*                    cache), and when it runs dry it steals from the front of somebody else's
+*                    (oldest first, which tends to be the biggest piece of work left).
+*       TaskGroup  : Fork/join on top of the pool. run() hands a task to the pool, wait() blocks
+*                    until all of them are done. A thread that is waiting keeps running tasks
+*                    instead of sleeping, so groups can be nested (a task can start its own
+*                    group) without running out of threads.
+*
+*       A pool with N threads starts N - 1 workers. The thread that waits on a TaskGroup is the
+*       N-th, so ThreadPool(1) runs everything on the calling thread.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17 -pthread)
+*
+*       For the idea behind work stealing, refer to the following:
+*       Link: https://en.wikipedia.org/wiki/Work_stealing
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class ThreadPool
+{
+    public:
+        // Defaults to one thread per core
+        explicit ThreadPool(size_t threadCount = std::thread::hardware_concurrency());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Queues a task on the calling thread's own deque
+        void submit(std::function<void()> task);
+        // Runs one queued task, its own or a stolen one. False if there was none.
+        bool runPendingTask();
+
+        size_t threadCount() const;
+
+    private:
+        // One per thread. Index 0 is shared by every thread outside the pool.
+        struct Queue
+        {
+            std::mutex lock;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread> workers_;
+
+        std::atomic<size_t> queued_; // Tasks sitting in any of the queues
+        std::atomic<bool> stopping_;
+
+        // Idle workers sleep here until something is queued
+        std::mutex sleepLock_;
+        std::condition_variable wake_;
+
+        // Which pool and queue the current thread belongs to
+        static inline thread_local ThreadPool* currentPool_ = nullptr;
+        static inline thread_local size_t currentQueue_ = 0;
+
+        size_t ownQueue() const;
+        void workerLoop(size_t index);
+};
+
+class TaskGroup
+{
+    public:
+        explicit TaskGroup(ThreadPool& pool);
+        // Waits for any tasks that are still running
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        template <typename FUNCTION>
+        void run(FUNCTION&& task);
+        // Blocks until every task has finished, and rethrows the first
+        // exception one of them threw
+        void wait();
+
+    private:
+        ThreadPool& pool_;
+        std::atomic<size_t> pending_;
+
+        std::mutex errorLock_;
+        std::exception_ptr error_;
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* THREAD POOL                                                                                                        */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: ThreadPool
+ * Description:
+ *      Creates the queues and starts threadCount - 1 worker threads.
+ * Parameters:
+ *      size_t threadCount : threads that work on tasks, counting the one
+ *                           that waits. 0 is treated as 1.
+ * Return:
+ *      None
+***************************************************************************/
+inline ThreadPool::ThreadPool(size_t threadCount) : queued_(0), stopping_(false)
+{
+    if(!threadCount)
+        threadCount = 1;
+
+    for(size_t i = 0; i < threadCount; i++)
+        queues_.push_back(std::make_unique<Queue>());
+
+    for(size_t i = 1; i < threadCount; i++)
+        workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+/***************************************************************************
+ * Function: ~ThreadPool
+ * Description:
+ *      Stops and joins the workers. Tasks still queued are dropped, so wait
+ *      on any TaskGroup before the pool goes away.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(sleepLock_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for(std::thread& worker : workers_)
+        worker.join();
+}
+
+/***************************************************************************
+ * Function: submit
+ * Description:
+ *      Pushes a task onto the back of the calling thread's queue, and wakes
+ *      up a sleeping worker to come and steal it.
+ * Parameters:
+ *      std::function<void()> task : the task
+ * Return:
+ *      None
+***************************************************************************/
+inline void ThreadPool::submit(std::function<void()> task)
+{
+    Queue& queue = *queues_[ownQueue()];
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    {
+        // Taking the lock makes sure a worker that just found nothing to do
+        // is either already asleep or will see the new count
+        std::lock_guard<std::mutex> guard(sleepLock_);
+        queued_++;
+    }
+    wake_.notify_one();
+}
+
+/***************************************************************************
+ * Function: runPendingTask
+ * Description:
+ *      Pops the newest task off our own queue, or if it's empty steals the
+ *      oldest task from one of the others, and runs it.
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true if a task was run
+***************************************************************************/
+inline bool ThreadPool::runPendingTask()
+{
+    if(!queued_)
+        return false;
+
+    size_t own = ownQueue();
+    std::function<void()> task;
+
+    for(size_t i = 0; i < queues_.size() && !task; i++)
+    {
+        Queue& queue = *queues_[(own + i) % queues_.size()];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if(queue.tasks.empty())
+            continue;
+
+        if(i == 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if(!task)
+        return false;
+
+    queued_--;
+    task();
+    return true;
+}
+
+/***************************************************************************
+ * Function: threadCount
+ * Description:
+ *      Returns how many threads work on tasks, counting the waiting one.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : number of threads
+***************************************************************************/
+inline size_t ThreadPool::threadCount() const
+{
+    return queues_.size();
+}
+
+/***************************************************************************
+ * Function: ownQueue
+ * Description:
+ *      Returns the index of the calling thread's queue. Threads that don't
+ *      belong to this pool all share queue 0.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : index into queues_
+***************************************************************************/
+inline size_t ThreadPool::ownQueue() const
+{
+    return currentPool_ == this ? currentQueue_ : 0;
+}
+
+/***************************************************************************
+ * Function: workerLoop
+ * Description:
+ *      What every worker thread runs: keep running tasks, and sleep while
+ *      there are none.
+ * Parameters:
+ *      size_t index : the worker's own queue
+ * Return:
+ *      None
+***************************************************************************/
+inline void ThreadPool::workerLoop(size_t index)
+{
+    currentPool_  = this;
+    currentQueue_ = index;
+
+    while(true)
+    {
+        if(runPendingTask())
+            continue;
+
+        std::unique_lock<std::mutex> guard(sleepLock_);
+        wake_.wait(guard, [this] { return stopping_ || queued_ > 0; });
+        if(stopping_)
+            return;
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF THREAD POOL                                                                                                 */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* TASK GROUP                                                                                                         */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: TaskGroup
+ * Description:
+ *      Creates an empty group that runs its tasks on the given pool.
+ * Parameters:
+ *      ThreadPool& pool : pool to run on
+ * Return:
+ *      None
+***************************************************************************/
+inline TaskGroup::TaskGroup(ThreadPool& pool) : pool_(pool), pending_(0) {}
+
+/***************************************************************************
+ * Function: ~TaskGroup
+ * Description:
+ *      Waits for the tasks that are still running, since they may point at
+ *      this group. Exceptions are dropped here, call wait() to see them.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline TaskGroup::~TaskGroup()
+{
+    try
+    {
+        wait();
+    }
+    catch(...) {}
+}
+
+/***************************************************************************
+ * Function: run
+ * Description:
+ *      Hands a task to the pool. An exception thrown by the task is kept and
+ *      rethrown by wait().
+ * Parameters:
+ *      FUNCTION&& task : anything callable with no arguments
+ * Return:
+ *      None
+***************************************************************************/
+template <typename FUNCTION>
+void TaskGroup::run(FUNCTION&& task)
+{
+    pending_++;
+    pool_.submit([this, task = std::forward<FUNCTION>(task)]() mutable
+    {
+        try
+        {
+            task();
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> guard(errorLock_);
+            if(!error_)
+                error_ = std::current_exception();
+        }
+        pending_--;
+    });
+}
+
+/***************************************************************************
+ * Function: wait
+ * Description:
+ *      Runs queued tasks (ours or anyone else's) until every task of this
+ *      group is done, then rethrows the first exception if there was one.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+inline void TaskGroup::wait()
+{
+    while(pending_)
+    {
+        if(!pool_.runPendingTask())
+            std::this_thread::yield();
+    }
+
+    if(error_)
+    {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF TASK GROUP                                                                                                  */
+/*====================================================================================================================*/
+#endif //THREAD_POOL_H
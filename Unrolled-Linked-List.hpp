@@ -0,0 +1,965 @@
+/*************************************************************************************************
+* File: Unrolled-Linked-List.hpp
+* Description:
+*       An unrolled singly linked list: every node (a "chunk") holds up to K elements in a small
+*       array instead of just one. With the default K a chunk fills one 64 byte cache line, so a
+*       scan takes one cache miss per K elements instead of one per element, and the per element
+*       overhead of the next pointer mostly disappears.
+*
+*       It has the same interface as SLL in Singly-Linked-List.hpp. A position in the list is a
+*       Position (a chunk and an index into it) instead of a Node<DATA>*. Inserting into a full
+*       chunk splits it in two; removing from a chunk that gets less than half full merges it
+*       with the next one if they fit together. Either way, a Position into a chunk that was
+*       changed may now point at a different element, so search() again after changing the list.
+*
+*       Like SLL, the chunks come from the process wide NodePoolResource unless a memory
+*       resource is given, and save()/load() use the same format as SLL, so one can load what
+*       the other saved.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the idea, refer to the following:
+*       Link: https://en.wikipedia.org/wiki/Unrolled_linked_list
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <memory>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <algorithm>
+#include <memory_resource>
+#include "Serialization.hpp"
+#include "Memory-Resources.hpp"
+
+// As many elements as fit in a 64 byte chunk next to the chunk's pointer and count
+template <typename DATA>
+constexpr size_t defaultChunkCapacity()
+{
+    return std::max<size_t>(1, (64 - sizeof(void*) - sizeof(size_t)) / sizeof(DATA));
+}
+
+template <typename DATA, size_t K = defaultChunkCapacity<DATA>()>
+class UnrolledSLL
+{
+    static_assert(K >= 1, "A chunk has to hold at least one element");
+
+    struct Chunk;
+
+    public:
+        // Where an element is: chunk->items()[index]. A null chunk means "nowhere".
+        struct Position
+        {
+            Chunk* chunk = nullptr;
+            size_t index = 0;
+
+            explicit operator bool() const { return chunk != nullptr; }
+            DATA& operator*() const { return chunk->items()[index]; }
+            DATA* operator->() const { return chunk->items() + index; }
+        };
+
+        // Default Constructor
+        UnrolledSLL();
+        // Constructor that allocates every chunk from the given resource
+        UnrolledSLL(std::pmr::memory_resource* resource);
+        // Destructor
+        ~UnrolledSLL();
+        // Copy Constructor
+        UnrolledSLL(const UnrolledSLL& objectToCopy);
+        // Copy Assignment Operator
+        void operator=(const UnrolledSLL& objectToCopy);
+
+        // Mutators
+        void push_front(const DATA&);
+        void push_front(DATA&&);
+        template <typename... ARGS>
+        DATA& emplace_front(ARGS&&...);
+        void pop_front();
+        void insert_after(const DATA&, int); // Insert After Given an "Index"
+        void insert_after(DATA&&, int);
+        void insert_after(const DATA&, Position); // Insert After given a Position
+        void insert_after(DATA&&, Position);
+        template <typename... ARGS>
+        DATA& emplace_after(int, ARGS&&...);
+        template <typename... ARGS>
+        DATA& emplace_after(Position, ARGS&&...);
+        void remove_after(int);
+        void remove_after(Position);
+        void clear();
+
+        // Accessors
+        DATA const& front();
+        DATA const& back();
+        size_t size();
+        // Number of chunks in use, for seeing how full they are
+        size_t chunkCount() const;
+        void print();
+        Position search(DATA);
+
+        // Binary save/load, same format as SLL (see Serialization.hpp)
+        void save(std::ostream& out) const;
+        void load(std::istream& in);
+
+        // Fun Functions!  :)
+        void reverse();
+
+    private:
+        struct Chunk
+        {
+            Chunk* next;
+            size_t count;
+            alignas(DATA) unsigned char storage[K * sizeof(DATA)];
+
+            DATA* items() { return reinterpret_cast<DATA*>(storage); }
+        };
+
+        std::pmr::memory_resource* resource_; // Where the chunks are allocated from
+
+        Chunk* head_; // First chunk, nullptr if the list is empty
+        Chunk* tail_; // Last chunk, nullptr if the list is empty
+
+        size_t size_;     // Number of elements
+        size_t chunks_;   // Number of chunks
+
+        // Finds the element with the given index
+        Position locate(size_t index) const;
+        // Puts value at position->index, moving the rest of the chunk back
+        DATA& insertAt(Position position, DATA&& value);
+        // Removes the element at a position. previous is the chunk before it.
+        void eraseAt(Chunk* previous, Position position);
+        // Adds an empty chunk after previous (or at the front if it's nullptr)
+        Chunk* linkChunk(Chunk* previous);
+        void unlinkChunk(Chunk* previous, Chunk* chunk);
+        Chunk* createChunk();
+        void destroyChunk(Chunk* chunk);
+};
+
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                              */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: UnrolledSLL
+ * Description:
+ *      The default constructor, creates an empty list whose chunks come from
+ *      the shared node pool.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+UnrolledSLL<DATA, K>::UnrolledSLL() : UnrolledSLL(&NodePoolResource::instance()) {}
+
+/***************************************************************************
+ * Function: UnrolledSLL
+ * Description:
+ *      Creates an empty list whose chunks come from the given memory
+ *      resource, which has to outlive the list.
+ * Parameters:
+ *      std::pmr::memory_resource* resource : where to allocate chunks from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+UnrolledSLL<DATA, K>::UnrolledSLL(std::pmr::memory_resource* resource) :
+resource_(resource), head_(nullptr), tail_(nullptr), size_(0), chunks_(0) {}
+
+/***************************************************************************
+ * Function: ~UnrolledSLL
+ * Description:
+ *      Destroys every element and frees every chunk.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+UnrolledSLL<DATA, K>::~UnrolledSLL()
+{
+    clear();
+}
+
+/***************************************************************************
+ * Function: UnrolledSLL
+ * Description:
+ *      The copy constructor.
+ * Parameters:
+ *      const UnrolledSLL &objectToCopy : list to copy from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+UnrolledSLL<DATA, K>::UnrolledSLL(const UnrolledSLL& objectToCopy) : UnrolledSLL()
+{
+    *this = objectToCopy;
+}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The copy assignment operator. The copy gets full chunks, however full
+ *      the chunks of the original are.
+ * Parameters:
+ *      const UnrolledSLL &rhs : list to copy from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::operator=(const UnrolledSLL& rhs)
+{
+    if(&rhs == this)
+        return;
+
+    clear();
+
+    for(Chunk* source = rhs.head_; source; source = source->next)
+    {
+        for(size_t index = 0; index < source->count; index++)
+        {
+            if(!tail_ || tail_->count == K)
+                linkChunk(tail_);
+
+            ::new (static_cast<void*>(tail_->items() + tail_->count)) DATA(source->items()[index]);
+            tail_->count++;
+            size_++;
+        }
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                       */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: push_front
+ * Description:
+ *      Pushes a copy of an element into the front of the list.
+ * Parameters:
+ *      const DATA& element : The desired element to be placed into the list
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::push_front(const DATA& element)
+{
+    emplace_front(element);
+}
+
+/***************************************************************************
+ * Function: push_front
+ * Description:
+ *      Moves an element into the front of the list.
+ * Parameters:
+ *      DATA&& element : The desired element to be placed into the list
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::push_front(DATA&& element)
+{
+    emplace_front(std::move(element));
+}
+
+/***************************************************************************
+ * Function: emplace_front
+ * Description:
+ *      Constructs a new element at the front of the list. If the first
+ *      chunk is full, a new chunk is put in front of it instead of
+ *      splitting it, so pushing to the front fills chunks completely.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA, size_t K>
+template <typename... ARGS>
+DATA& UnrolledSLL<DATA, K>::emplace_front(ARGS&&... args)
+{
+    DATA value(std::forward<ARGS>(args)...);
+
+    if(!head_ || head_->count == K)
+        linkChunk(nullptr);
+
+    return insertAt(Position{head_, 0}, std::move(value));
+}
+
+/***************************************************************************
+ * Function: pop_front
+ * Description:
+ *      Removes the first element from the list
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::pop_front()
+{
+    // cannot remove from an empty list!
+    if(size_ == 0)
+        return;
+
+    eraseAt(nullptr, Position{head_, 0});
+}
+
+/***************************************************************************
+ * Function: insert_after
+ * Description:
+ *      Inserts a copy of an element after the given index.
+ * Parameters:
+ *      const DATA& d   : The desired element to be placed into the list
+ *      int         idx : The index to insert after. (0 : size_-1)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::insert_after(const DATA& d, int idx)
+{
+    emplace_after(idx, d);
+}
+
+/***************************************************************************
+ * Function: insert_after
+ * Description:
+ *      Moves an element into the list after the given index.
+ * Parameters:
+ *      DATA&& d   : The desired element to be placed into the list
+ *      int    idx : The index to insert after. (0 : size_-1)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::insert_after(DATA&& d, int idx)
+{
+    emplace_after(idx, std::move(d));
+}
+
+/***************************************************************************
+ * Function: insert_after
+ * Description:
+ *      Inserts a copy of an element after the given position.
+ * Parameters:
+ *      const DATA& element : The desired element to be placed into the list
+ *      Position position   : The element to insert after
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::insert_after(const DATA& element, Position position)
+{
+    emplace_after(position, element);
+}
+
+/***************************************************************************
+ * Function: insert_after
+ * Description:
+ *      Moves an element into the list after the given position.
+ * Parameters:
+ *      DATA&& element    : The desired element to be placed into the list
+ *      Position position : The element to insert after
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::insert_after(DATA&& element, Position position)
+{
+    emplace_after(position, std::move(element));
+}
+
+/***************************************************************************
+ * Function: emplace_after
+ * Description:
+ *      Constructs a new element in place after the given index.
+ * Parameters:
+ *      int       idx  : The index to insert after. (0 : size_-1)
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA, size_t K>
+template <typename... ARGS>
+DATA& UnrolledSLL<DATA, K>::emplace_after(int idx, ARGS&&... args)
+{
+    if(idx < 0 || idx > static_cast<int>(this->size_-1)){
+        throw std::out_of_range("ERROR: index out of bounds!");
+    }
+
+    return emplace_after(locate(idx), std::forward<ARGS>(args)...);
+}
+
+/***************************************************************************
+ * Function: emplace_after
+ * Description:
+ *      Constructs a new element in place after the given position. If the
+ *      position is the last element of a full chunk, the element goes at
+ *      the front of the next chunk when that one has room, otherwise the
+ *      chunk is split.
+ * Parameters:
+ *      Position position : The element to insert after
+ *      ARGS&&... args    : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA, size_t K>
+template <typename... ARGS>
+DATA& UnrolledSLL<DATA, K>::emplace_after(Position position, ARGS&&... args)
+{
+    if(!position || position.index >= position.chunk->count)
+        throw std::out_of_range("INVALID POSITION GIVEN!");
+
+    DATA value(std::forward<ARGS>(args)...);
+
+    Chunk* chunk = position.chunk;
+    size_t index = position.index + 1;
+    if(index == K && chunk->next && chunk->next->count < K)
+        return insertAt(Position{chunk->next, 0}, std::move(value));
+
+    return insertAt(Position{chunk, index}, std::move(value));
+}
+
+/***************************************************************************
+ * Function: remove_after
+ * Description:
+ *      Removes the element after the given position, if there is one.
+ * Parameters:
+ *      Position position : The element before the one to remove
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::remove_after(Position position)
+{
+    if(!position || position.index >= position.chunk->count)
+        return;
+
+    if(position.index + 1 < position.chunk->count)
+    {
+        // The chunk before position.chunk is only needed to unlink an empty
+        // chunk, and position.chunk still holds position after this
+        eraseAt(nullptr, Position{position.chunk, position.index + 1});
+    }
+    else if(position.chunk->next)
+    {
+        eraseAt(position.chunk, Position{position.chunk->next, 0});
+    }
+}
+
+/***************************************************************************
+ * Function: remove_after
+ * Description:
+ *      Removes the element after the given index
+ * Parameters:
+ *      int idx : the index at which we remove the following element
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::remove_after(int idx)
+{
+    if(idx < 0 || idx >= static_cast<int>(this->size_-1))
+        throw std::out_of_range("ERROR: index out of bounds!");
+
+    remove_after(locate(idx));
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Destroys every element and frees every chunk.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::clear()
+{
+    while(head_)
+    {
+        Chunk* next = head_->next;
+        std::destroy(head_->items(), head_->items() + head_->count);
+        destroyChunk(head_);
+        head_ = next;
+    }
+
+    tail_ = nullptr;
+    size_ = 0;
+    chunks_ = 0;
+}
+
+/*====================================================================================================================*/
+/* END OF MUTATORS                                                                                                    */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: front
+ * Description:
+ *      Returns the front element of the list.
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA const& : Element at the front of the list
+***************************************************************************/
+template <typename DATA, size_t K>
+DATA const& UnrolledSLL<DATA, K>::front()
+{
+    if(!this->size()){
+        throw std::out_of_range("ERROR: cannot access the front of empty Queue");
+    }
+    return head_->items()[0];
+}
+
+/***************************************************************************
+ * Function: back
+ * Description:
+ *      Returns the back element of the list.
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA const& : Element at the back of the list
+***************************************************************************/
+template <typename DATA, size_t K>
+DATA const& UnrolledSLL<DATA, K>::back()
+{
+    if(!this->size()){
+        throw std::out_of_range("ERROR: cannot access the back of empty Queue");
+    }
+    return tail_->items()[tail_->count - 1];
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the number of elements in the list
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : size of the list
+***************************************************************************/
+template <typename DATA, size_t K>
+size_t UnrolledSLL<DATA, K>::size()
+{
+    return size_;
+}
+
+/***************************************************************************
+ * Function: chunkCount
+ * Description:
+ *      Returns the number of chunks. size() / (chunkCount() * K) is how full
+ *      the chunks are on average.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : number of chunks
+***************************************************************************/
+template <typename DATA, size_t K>
+size_t UnrolledSLL<DATA, K>::chunkCount() const
+{
+    return chunks_;
+}
+
+/***************************************************************************
+ * Function: print
+ * Description:
+ *      Prints the list starting from the head, the same way SLL does.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::print()
+{
+    if(this->size_ <= 0) return;// cannot print an empty list!
+    std::cout << "\n";// formatting
+
+    std::cout << "[HEAD]-> ";
+    for(Chunk* chunk = head_; chunk; chunk = chunk->next)
+        for(size_t index = 0; index < chunk->count; index++)
+            std::cout << chunk->items()[index] << "-> ";
+    std::cout << "[TAIL]-> nullptr\n";
+}
+
+/***************************************************************************
+ * Function: search
+ * Description:
+ *      Looks for the given element in the list. Each chunk is scanned as a
+ *      plain array.
+ * Parameters:
+ *      DATA element : the element to try to find in the list.
+ * Return:
+ *      Position : where the element is, a null Position if it isn't found
+***************************************************************************/
+template <typename DATA, size_t K>
+typename UnrolledSLL<DATA, K>::Position UnrolledSLL<DATA, K>::search(DATA element)
+{
+    for(Chunk* chunk = head_; chunk; chunk = chunk->next)
+    {
+        DATA* items = chunk->items();
+        for(size_t index = 0; index < chunk->count; index++)
+            if(items[index] == element)
+                return Position{chunk, index};
+    }
+    return Position{};
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+/*====================================================================================================================*/
+/* SERIALIZATION                                                                                                      */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: save
+ * Description:
+ *      Writes the list to a binary stream, from head to tail, exactly like
+ *      SLL::save does.
+ * Parameters:
+ *      std::ostream& out : stream to write to (open it in binary mode)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::save(std::ostream& out) const
+{
+    writeHeader<DATA>(out, ContainerTag::SLL, size_);
+
+    for(Chunk* chunk = head_; chunk; chunk = chunk->next)
+        for(size_t index = 0; index < chunk->count; index++)
+            writeElement(out, chunk->items()[index]);
+}
+
+/***************************************************************************
+ * Function: load
+ * Description:
+ *      Replaces the contents of the list with a list written by save() (of
+ *      an UnrolledSLL or an SLL). The chunks are filled up completely.
+ * Parameters:
+ *      std::istream& in : stream to read from (open it in binary mode)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::load(std::istream& in)
+{
+    uint64_t count = readHeader<DATA>(in, ContainerTag::SLL);
+
+    clear();
+
+    for(uint64_t index = 0; index < count; index++)
+    {
+        DATA element;
+        readElement(in, element);
+
+        if(!tail_ || tail_->count == K)
+            linkChunk(tail_);
+
+        ::new (static_cast<void*>(tail_->items() + tail_->count)) DATA(std::move(element));
+        tail_->count++;
+        size_++;
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF SERIALIZATION                                                                                               */
+/*====================================================================================================================*/
+
+/*====================================================================================================================*/
+/* FUN FUNCTIONS                                                                                                      */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: reverse
+ * Description:
+ *      Reverses the list: the chunks are relinked back to front, and the
+ *      elements inside each chunk are reversed in place.
+ * Parameters:
+ *      none
+ * Return:
+ *      none
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::reverse()
+{
+    Chunk* previous = nullptr;
+    Chunk* chunk = head_;
+    tail_ = head_;
+
+    while(chunk)
+    {
+        std::reverse(chunk->items(), chunk->items() + chunk->count);
+
+        Chunk* next = chunk->next;
+        chunk->next = previous;
+        previous = chunk;
+        chunk = next;
+    }
+
+    head_ = previous;
+}
+
+/*====================================================================================================================*/
+/* END OF FUN FUNCTIONS                                                                                               */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: locate
+ * Description:
+ *      Finds the element with the given index, skipping whole chunks.
+ * Parameters:
+ *      size_t index : index of the element, must be < size()
+ * Return:
+ *      Position : where it is
+***************************************************************************/
+template <typename DATA, size_t K>
+typename UnrolledSLL<DATA, K>::Position UnrolledSLL<DATA, K>::locate(size_t index) const
+{
+    Chunk* chunk = head_;
+    while(index >= chunk->count)
+    {
+        index -= chunk->count;
+        chunk = chunk->next;
+    }
+    return Position{chunk, index};
+}
+
+/***************************************************************************
+ * Function: insertAt
+ * Description:
+ *      Puts value at the given position, moving the elements from there on
+ *      one slot back. A full chunk is split first: its back half moves to a
+ *      new chunk after it.
+ * Parameters:
+ *      Position position : where the new element goes (index <= count)
+ *      DATA&& value      : the element
+ * Return:
+ *      DATA& : the element in the list
+***************************************************************************/
+template <typename DATA, size_t K>
+DATA& UnrolledSLL<DATA, K>::insertAt(Position position, DATA&& value)
+{
+    Chunk* chunk = position.chunk;
+    size_t index = position.index;
+
+    if(chunk->count == K)
+    {
+        Chunk* second = linkChunk(chunk);
+        size_t keep = (K + 1) / 2;
+
+        for(size_t from = keep; from < K; from++, second->count++)
+        {
+            ::new (static_cast<void*>(second->items() + second->count)) DATA(std::move_if_noexcept(chunk->items()[from]));
+            std::destroy_at(chunk->items() + from);
+        }
+        chunk->count = keep;
+
+        // index == keep can go either way; it has to go to second when
+        // chunk is still full, which is the case when K is 1
+        if(index > keep || (index == keep && keep == K))
+        {
+            chunk = second;
+            index -= keep;
+        }
+    }
+
+    DATA* items = chunk->items();
+    if(index == chunk->count)
+    {
+        ::new (static_cast<void*>(items + index)) DATA(std::move(value));
+    }
+    else
+    {
+        ::new (static_cast<void*>(items + chunk->count)) DATA(std::move(items[chunk->count - 1]));
+        std::move_backward(items + index, items + chunk->count - 1, items + chunk->count);
+        items[index] = std::move(value);
+    }
+
+    chunk->count++;
+    size_++;
+
+    return items[index];
+}
+
+/***************************************************************************
+ * Function: eraseAt
+ * Description:
+ *      Removes the element at a position, moving the rest of its chunk one
+ *      slot forward. An emptied chunk is freed. A chunk left less than half
+ *      full takes in the next chunk if both fit in one.
+ * Parameters:
+ *      Chunk* previous   : the chunk before position.chunk (only needed, and
+ *                          only used, if position.chunk can become empty)
+ *      Position position : the element to remove
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::eraseAt(Chunk* previous, Position position)
+{
+    Chunk* chunk = position.chunk;
+    DATA* items = chunk->items();
+
+    std::move(items + position.index + 1, items + chunk->count, items + position.index);
+    std::destroy_at(items + chunk->count - 1);
+    chunk->count--;
+    size_--;
+
+    if(chunk->count == 0)
+    {
+        unlinkChunk(previous, chunk);
+        return;
+    }
+
+    Chunk* next = chunk->next;
+    if(next && chunk->count < K / 2 && chunk->count + next->count <= K)
+    {
+        for(size_t from = 0; from < next->count; from++, chunk->count++)
+        {
+            ::new (static_cast<void*>(items + chunk->count)) DATA(std::move_if_noexcept(next->items()[from]));
+            std::destroy_at(next->items() + from);
+        }
+        next->count = 0;
+        unlinkChunk(chunk, next);
+    }
+}
+
+/***************************************************************************
+ * Function: linkChunk
+ * Description:
+ *      Creates an empty chunk and links it in after previous.
+ * Parameters:
+ *      Chunk* previous : the chunk to link after, nullptr = the front
+ * Return:
+ *      Chunk* : the new chunk
+***************************************************************************/
+template <typename DATA, size_t K>
+typename UnrolledSLL<DATA, K>::Chunk* UnrolledSLL<DATA, K>::linkChunk(Chunk* previous)
+{
+    Chunk* chunk = createChunk();
+
+    if(previous)
+    {
+        chunk->next = previous->next;
+        previous->next = chunk;
+    }
+    else
+    {
+        chunk->next = head_;
+        head_ = chunk;
+    }
+
+    if(tail_ == previous)
+        tail_ = chunk;
+
+    chunks_++;
+    return chunk;
+}
+
+/***************************************************************************
+ * Function: unlinkChunk
+ * Description:
+ *      Unlinks an empty chunk and frees it. If previous is nullptr, chunk
+ *      has to be the first chunk, or the chunk before it is searched for.
+ * Parameters:
+ *      Chunk* previous : the chunk before chunk, if known
+ *      Chunk* chunk    : the chunk to remove
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::unlinkChunk(Chunk* previous, Chunk* chunk)
+{
+    if(!previous && chunk != head_)
+    {
+        previous = head_;
+        while(previous->next != chunk)
+            previous = previous->next;
+    }
+
+    if(previous)
+        previous->next = chunk->next;
+    else
+        head_ = chunk->next;
+
+    if(tail_ == chunk)
+        tail_ = previous;
+
+    destroyChunk(chunk);
+    chunks_--;
+}
+
+/***************************************************************************
+ * Function: createChunk
+ * Description:
+ *      Allocates an empty chunk from resource_.
+ * Parameters:
+ *      None
+ * Return:
+ *      Chunk* : the chunk, not linked to anything
+***************************************************************************/
+template <typename DATA, size_t K>
+typename UnrolledSLL<DATA, K>::Chunk* UnrolledSLL<DATA, K>::createChunk()
+{
+    Chunk* chunk = std::pmr::polymorphic_allocator<Chunk>(resource_).allocate(1);
+    chunk->next = nullptr;
+    chunk->count = 0;
+    return chunk;
+}
+
+/***************************************************************************
+ * Function: destroyChunk
+ * Description:
+ *      Gives a chunk back to resource_. Its elements must already be
+ *      destroyed.
+ * Parameters:
+ *      Chunk* chunk : the chunk to free
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, size_t K>
+void UnrolledSLL<DATA, K>::destroyChunk(Chunk* chunk)
+{
+    std::pmr::polymorphic_allocator<Chunk>(resource_).deallocate(chunk, 1);
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+#endif
@@ -0,0 +1,1637 @@
+/*************************************************************************************************
+* File: Vector-Bool.hpp
+* Description:
+*       Vector<bool> stores its flags as bits, 64 to a word, so it takes 8 times less memory than
+*       a bool per byte and grows by copying whole words. It is included at the end of
+*       Vector.hpp, so every Vector<bool> is this one.
+*
+*       Because the flags are bits, there is no bool& to hand out: operator[] returns a small
+*       BitReference that reads and writes the bit, the iterators are random access iterators
+*       that hand out BitReferences, and data() is replaced by words(). On top of the usual
+*       Vector functions it has the bitmap operations:
+*           count()                : number of set flags (popcount)
+*           findFirst()/findNext() : index of the first set flag (find first set)
+*           &=, |=, ^=             : word by word, with AVX2 when the CPU has it
+*           flipAll()              : word by word, a plain loop the compiler vectorizes
+*
+*       The bits past size() in the last word are always kept at 0, so the bulk operations can
+*       work on whole words without masking.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the STL implementation, refer to the following:
+*       Link: https://en.cppreference.com/w/cpp/container/vector_bool
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef VECTOR_BOOL_H
+#define VECTOR_BOOL_H
+
+#include "Vector.hpp"
+#include "Simd-Level.hpp"
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+
+/*
+* Word loops behind the bulk operations. The AVX2 versions do 4 words (256
+* flags) per instruction and leave the last few words to the scalar loop.
+*/
+struct BitKernels
+{
+    enum class Op { AND, OR, XOR };
+
+    static void combine(uint64_t* target, const uint64_t* source, size_t words, Op op)
+    {
+        for(size_t i = 0; i < words; i++)
+            target[i] = op == Op::AND ? target[i] & source[i]
+                      : op == Op::OR  ? target[i] | source[i]
+                                      : target[i] ^ source[i];
+    }
+
+    static size_t popcount(const uint64_t* words, size_t count)
+    {
+        size_t total = 0;
+        for(size_t i = 0; i < count; i++)
+            total += __builtin_popcountll(words[i]);
+        return total;
+    }
+
+    #ifdef VECTOR_SIMD_X86
+    AVX2_TARGET static void combineAvx2(uint64_t* target, const uint64_t* source, size_t words, Op op)
+    {
+        size_t i = 0;
+        for(; i + 4 <= words; i += 4)
+        {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+            __m256i r = op == Op::AND ? _mm256_and_si256(a, b)
+                      : op == Op::OR  ? _mm256_or_si256(a, b)
+                                      : _mm256_xor_si256(a, b);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), r);
+        }
+        combine(target + i, source + i, words - i, op);
+    }
+
+    // Every CPU with AVX2 also has the POPCNT instruction
+    __attribute__((target("avx2,popcnt"))) static size_t popcountAvx2(const uint64_t* words, size_t count)
+    {
+        // Four running totals so the popcnt instructions don't wait on each other
+        uint64_t totals[4] = {0, 0, 0, 0};
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4)
+        {
+            totals[0] += _mm_popcnt_u64(words[i]);
+            totals[1] += _mm_popcnt_u64(words[i + 1]);
+            totals[2] += _mm_popcnt_u64(words[i + 2]);
+            totals[3] += _mm_popcnt_u64(words[i + 3]);
+        }
+        for(; i < count; i++)
+            totals[0] += _mm_popcnt_u64(words[i]);
+
+        return totals[0] + totals[1] + totals[2] + totals[3];
+    }
+    #endif
+};
+
+template<typename GROWTH>
+class Vector<bool, GROWTH>
+{
+    public:
+        using value_type      = bool;
+        // Flags are returned by value, there's no bool to point at
+        using const_reference = bool;
+
+        // Stands in for a bool& to a single bit
+        class BitReference
+        {
+            public:
+                BitReference(uint64_t* word, uint64_t mask) : word_(word), mask_(mask) {}
+
+                operator bool() const { return (*word_ & mask_) != 0; }
+                BitReference& operator=(bool value)
+                {
+                    if(value)
+                        *word_ |= mask_;
+                    else
+                        *word_ &= ~mask_;
+                    return *this;
+                }
+                BitReference& operator=(const BitReference& other) { return *this = bool(other); }
+                // Swaps the flags, not the references, so algorithms like std::sort work
+                friend void swap(BitReference lhs, BitReference rhs)
+                {
+                    bool value = lhs;
+                    lhs = bool(rhs);
+                    rhs = value;
+                }
+
+            private:
+                uint64_t* word_;
+                uint64_t  mask_;
+        };
+
+        // Random access iterator over the flags. There's no bool to point at,
+        // so * gives a BitReference (or a plain bool for a const_iterator).
+        template <bool CONST>
+        class BitIterator
+        {
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type        = bool;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = void;
+                using reference         = std::conditional_t<CONST, bool, BitReference>;
+                using word_pointer      = std::conditional_t<CONST, const uint64_t*, uint64_t*>;
+
+                BitIterator() : words_(nullptr), index_(0) {}
+                BitIterator(word_pointer words, size_t index) : words_(words), index_(index) {}
+                // An iterator converts to a const_iterator
+                template <bool OTHER, typename = std::enable_if_t<CONST && !OTHER>>
+                BitIterator(const BitIterator<OTHER>& other) : words_(other.words()), index_(other.index()) {}
+
+                reference operator*() const { return (*this)[0]; }
+                reference operator[](difference_type offset) const
+                {
+                    size_t index = index_ + offset;
+                    if constexpr(CONST)
+                        return (words_[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+                    else
+                        return BitReference(words_ + index / WORD_BITS, uint64_t(1) << (index % WORD_BITS));
+                }
+
+                BitIterator& operator++() { index_++; return *this; }
+                BitIterator operator++(int) { BitIterator old = *this; index_++; return old; }
+                BitIterator& operator--() { index_--; return *this; }
+                BitIterator operator--(int) { BitIterator old = *this; index_--; return old; }
+                BitIterator& operator+=(difference_type offset) { index_ += offset; return *this; }
+                BitIterator& operator-=(difference_type offset) { index_ -= offset; return *this; }
+                friend BitIterator operator+(BitIterator it, difference_type offset) { return it += offset; }
+                friend BitIterator operator+(difference_type offset, BitIterator it) { return it += offset; }
+                friend BitIterator operator-(BitIterator it, difference_type offset) { return it -= offset; }
+                friend difference_type operator-(const BitIterator& lhs, const BitIterator& rhs)
+                {
+                    return difference_type(lhs.index_) - difference_type(rhs.index_);
+                }
+
+                friend bool operator==(const BitIterator& lhs, const BitIterator& rhs) { return lhs.index_ == rhs.index_; }
+                friend bool operator!=(const BitIterator& lhs, const BitIterator& rhs) { return lhs.index_ != rhs.index_; }
+                friend bool operator<(const BitIterator& lhs, const BitIterator& rhs)  { return lhs.index_ < rhs.index_; }
+                friend bool operator>(const BitIterator& lhs, const BitIterator& rhs)  { return lhs.index_ > rhs.index_; }
+                friend bool operator<=(const BitIterator& lhs, const BitIterator& rhs) { return lhs.index_ <= rhs.index_; }
+                friend bool operator>=(const BitIterator& lhs, const BitIterator& rhs) { return lhs.index_ >= rhs.index_; }
+
+                word_pointer words() const { return words_; }
+                size_t index() const { return index_; }
+
+            private:
+                word_pointer words_; // The Vector's words
+                size_t index_;       // Flag the iterator is at
+        };
+
+        using iterator       = BitIterator<false>;
+        using const_iterator = BitIterator<true>;
+
+        static constexpr size_t WORD_BITS = 64;
+
+        // Default Constructor
+        Vector();
+        // Overloaded Constructor (capacity in flags)
+        Vector(int);
+        // Constructors that take their memory from the given resource
+        Vector(std::pmr::memory_resource* resource);
+        Vector(int, std::pmr::memory_resource* resource);
+        //Destructor
+        ~Vector();
+        // Copy Constructor
+        Vector(const Vector & objectToCopy);
+        // Move Constructor
+        Vector(Vector&& objectToMove) noexcept;
+        // Copy Assignment Operator
+        Vector<bool, GROWTH>& operator=(const Vector &objectToCopy);
+        // Move Assignment Operator
+        Vector<bool, GROWTH>& operator=(Vector&& objectToMove);
+
+        // Mutators
+        void push_back(bool data);
+        template <typename... ARGS>
+        BitReference emplace_back(ARGS&&... args);
+        void insertAt(size_t index, bool data);
+        template <typename ITER>
+        void insert(size_t index, ITER first, ITER last);
+        template <typename RANGE>
+        void append(const RANGE& range);
+        void erase(size_t first, size_t last);
+        template <typename PREDICATE>
+        size_t erase_if(PREDICATE pred);
+        void pop_back();
+        void clear();
+        void reserve(size_t newCapacity);
+        void shrink_to_fit();
+        void assign(size_t count, bool value);
+        void set(size_t index, bool value = true);
+        void flip(size_t index);
+
+        // Bitmap operations (both Vectors must have the same size)
+        Vector<bool, GROWTH>& operator&=(const Vector& other);
+        Vector<bool, GROWTH>& operator|=(const Vector& other);
+        Vector<bool, GROWTH>& operator^=(const Vector& other);
+        void flipAll();
+        size_t count() const;
+        size_t findFirst() const;
+        size_t findNext(size_t index) const;
+
+        // Accessors
+        bool front();
+        bool back();
+        size_t const& size() const;
+        size_t const& capacity() const;
+        bool empty() const;
+        std::pmr::memory_resource* resource() const;
+        BitReference operator[](size_t index);
+        bool operator[](size_t index) const;
+        BitReference at(size_t index);
+        bool at(size_t index) const;
+        bool test(size_t index) const;
+        uint64_t* words();
+        const uint64_t* words() const;
+        size_t wordCount() const;
+
+        // Iterators
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        // Binary save/load, see Serialization.hpp for the format
+        void save(std::ostream& out) const;
+        void load(std::istream& in);
+
+        // Used for testing purposes
+        void displayVector();
+
+    private:
+        // Where the words come from. nullptr means the regular heap.
+        std::pmr::memory_resource* resource_;
+
+        // The flags, bit i of the Vector is bit (i % 64) of word i / 64
+        uint64_t* words_;
+
+        // Both counted in flags, the capacity is always a multiple of 64
+        size_t capacity_;
+        size_t size_;
+
+        static size_t wordsFor(size_t bits) { return (bits + WORD_BITS - 1) / WORD_BITS; }
+
+        // Called when expanding Vector
+        void resize();
+        void reallocate(size_t newWordCount);
+        void combine(const Vector& other, BitKernels::Op op);
+        // Clears the unused bits of the last word
+        void trimLastWord();
+        // Reads/writes up to 64 flags starting at any bit
+        uint64_t readBits(size_t bit) const;
+        void writeBits(size_t bit, uint64_t bits, size_t count);
+        // Moves count flags from one position to another, overlap allowed
+        void moveBits(size_t from, size_t to, size_t count);
+        // Sets the size to a smaller one, zeroing the bits that were cut off
+        void shrinkTo(size_t newSize);
+        uint64_t* allocate(size_t wordCount);
+        void deallocate(uint64_t* storage, size_t wordCount);
+        bool sameResource(const Vector& other) const;
+        void release();
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              CLASS DEFINITIONS                                                     */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                              */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: Vector
+ * Description:
+ *      Creates a new Vector<bool> with room for at least the given number
+ *      of flags.
+ * Parameters:
+ *      int userDefinedCapacity : initial capacity, in flags
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>::Vector(int userDefinedCapacity) : Vector(userDefinedCapacity, nullptr) {}
+
+/***************************************************************************
+ * Function: Vector
+ * Description:
+ *      Creates a new Vector<bool> with room for at least the given number
+ *      of flags, that gets its words from the given memory resource.
+ * Parameters:
+ *      int userDefinedCapacity : initial capacity, in flags
+ *      std::pmr::memory_resource* resource : where to allocate from.
+ *                                            nullptr = the regular heap.
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>::Vector(int userDefinedCapacity, std::pmr::memory_resource* resource) :
+resource_(resource), words_(nullptr), capacity_(0), size_(0)
+{
+    reallocate(wordsFor(userDefinedCapacity > 0 ? userDefinedCapacity : 0));
+}
+
+/***************************************************************************
+ * Function: Vector
+ * Description:
+ *      Creates a new, empty Vector<bool> that gets its words from the given
+ *      memory resource.
+ * Parameters:
+ *      std::pmr::memory_resource* resource : where to allocate from.
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>::Vector(std::pmr::memory_resource* resource) : Vector(WORD_BITS, resource) {}
+
+/***************************************************************************
+ * Function: Vector (Default Constructor)
+ * Description:
+ *      Creates a new, empty Vector<bool> with room for one word of flags.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>::Vector() : Vector(WORD_BITS) {}
+
+/***************************************************************************
+ * Function: Vector (Copy Constructor)
+ * Description:
+ *      Copies the words of another Vector<bool> with one memcpy. Like the
+ *      general Vector, the copy uses the regular heap.
+ * Parameters:
+ *      const Vector &objectToCopy : Vector to copy from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>::Vector(const Vector &objectToCopy) :
+resource_(nullptr), words_(nullptr), capacity_(0), size_(0)
+{
+    std::cout << "CSTOR was called...\n";
+    reallocate(wordsFor(objectToCopy.capacity_));
+    std::memcpy(words_, objectToCopy.words_, objectToCopy.wordCount() * sizeof(uint64_t));
+    size_ = objectToCopy.size_;
+}
+
+/***************************************************************************
+ * Function: Vector (Move Constructor)
+ * Description:
+ *      Takes over the words of another Vector<bool>, leaving it empty.
+ * Parameters:
+ *      Vector&& objectToMove : Vector to move contents from
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>::Vector(Vector&& objectToMove) noexcept :
+
+resource_(objectToMove.resource_),
+words_   (objectToMove.words_),
+capacity_(objectToMove.capacity_),
+size_    (objectToMove.size_)
+{
+    std::cout << "Move CSTOR Called...\n";
+    objectToMove.words_ = nullptr;
+    objectToMove.capacity_ = 0;
+    objectToMove.size_ = 0;
+}
+
+/***************************************************************************
+ * Function: ~Vector
+ * Description:
+ *      Frees the words.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>::~Vector()
+{
+    std::cout << "Destrucor was called...\n";
+    release();
+}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The copy assignment operator. Reuses our words if they're enough.
+ * Parameters:
+ *      Vector &objectToCopy : Vector to copy from
+ * Return:
+ *      Vector& : this Vector
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>& Vector<bool, GROWTH>::operator=(const Vector& objectToCopy)
+{
+    std::cout << "Copy Assign Op Called...\n";
+    if(&objectToCopy == this)
+        return *this;
+
+    clear();
+    if(objectToCopy.size_ > capacity_)
+        reallocate(objectToCopy.wordCount());
+
+    std::memcpy(words_, objectToCopy.words_, objectToCopy.wordCount() * sizeof(uint64_t));
+    size_ = objectToCopy.size_;
+
+    return *this;
+}
+
+/***************************************************************************
+ * Function: operator=
+ * Description:
+ *      The move assignment operator. Takes over the other Vector's words,
+ *      or copies them if they come from a different memory resource.
+ * Parameters:
+ *      Vector&& objectToMove : Vector to move contents from
+ * Return:
+ *      Vector& : this Vector
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>& Vector<bool, GROWTH>::operator=(Vector&& objectToMove)
+{
+    std::cout << "Move Assign Op Called...\n";
+    if(&objectToMove != this && !sameResource(objectToMove))
+    {
+        clear();
+        reserve(objectToMove.size_);
+        std::memcpy(words_, objectToMove.words_, objectToMove.wordCount() * sizeof(uint64_t));
+        size_ = objectToMove.size_;
+        objectToMove.release();
+    }
+    else if(&objectToMove != this)
+    {
+        release();
+
+        words_    = objectToMove.words_;
+        capacity_ = objectToMove.capacity_;
+        size_     = objectToMove.size_;
+
+        objectToMove.words_    = nullptr;
+        objectToMove.capacity_ = 0;
+        objectToMove.size_     = 0;
+    }
+
+    return *this;
+}
+/*====================================================================================================================*/
+/* END OF CONSTRUCTORS, DESTRUCTOR AND COPY ASSIGNMENT OPERATOR                                                       */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* MUTATORS                                                                                                           */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: push_back
+ * Description:
+ *      Appends a flag, growing by whole words when the last one is full.
+ * Parameters:
+ *      bool inputData : the flag to append
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::push_back(bool inputData)
+{
+    if(size_ == capacity_)
+        resize();
+
+    // The bit is already 0, see trimLastWord()
+    if(inputData)
+        words_[size_ / WORD_BITS] |= uint64_t(1) << (size_ % WORD_BITS);
+    size_++;
+}
+
+/***************************************************************************
+ * Function: emplace_back
+ * Description:
+ *      Appends a flag made from the given arguments.
+ * Parameters:
+ *      ARGS&&... args : Arguments a bool is constructed from
+ * Return:
+ *      BitReference : the new flag
+***************************************************************************/
+template <typename GROWTH>
+template <typename... ARGS>
+typename Vector<bool, GROWTH>::BitReference Vector<bool, GROWTH>::emplace_back(ARGS&&... args)
+{
+    push_back(bool(std::forward<ARGS>(args)...));
+    return (*this)[size_ - 1];
+}
+
+/***************************************************************************
+ * Function: insertAt
+ * Description:
+ *      Inserts a flag at a specific location, pushing the flags after it
+ *      back by one. Inserting at index size() is the same as a push_back.
+ * Parameters:
+ *      size_t index   : The location to insert the new flag
+ *      bool inputData : The flag to insert
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::insertAt(size_t index, bool inputData)
+{
+    insert(index, &inputData, &inputData + 1);
+}
+
+/***************************************************************************
+ * Function: insert
+ * Description:
+ *      Inserts the flags in [first, last) before index. The flags after
+ *      index are shifted once, up to 64 at a time, not once per new flag.
+ *      Iterators that can only be walked once are copied into a temporary
+ *      Vector first, to count them.
+ * Parameters:
+ *      size_t index : The location to insert the flags at
+ *      ITER first   : Start of the flags to insert
+ *      ITER last    : End of the flags to insert
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+template <typename ITER>
+void Vector<bool, GROWTH>::insert(size_t index, ITER first, ITER last)
+{
+    // Check to see if the index is valid
+    if(index > size_)
+        throw std::out_of_range("Not a valid Index to Insert.");
+
+    using CATEGORY = typename std::iterator_traits<ITER>::iterator_category;
+    if constexpr(!std::is_base_of<std::forward_iterator_tag, CATEGORY>::value)
+    {
+        Vector<bool, GROWTH> flags(resource_);
+        for(; first != last; ++first)
+            flags.push_back(bool(*first));
+        insert(index, flags.begin(), flags.end());
+    }
+    else
+    {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if(count == 0)
+            return;
+
+        // Our own flags would move under the iterators when we grow
+        if constexpr(std::is_same<ITER, iterator>::value || std::is_same<ITER, const_iterator>::value)
+        {
+            if(first.words() == words_)
+            {
+                Vector<bool, GROWTH> flags(resource_);
+                flags.insert(0, first, last);
+                insert(index, flags.cbegin(), flags.cend());
+                return;
+            }
+        }
+
+        if(size_ + count > capacity_)
+            reallocate(std::max(wordsFor(size_ + count), GROWTH::grow(wordsFor(capacity_), sizeof(uint64_t))));
+
+        moveBits(index, index + count, size_ - index);
+        size_ += count;
+
+        for(size_t position = index; first != last; ++first, ++position)
+            (*this)[position] = bool(*first);
+    }
+}
+
+/***************************************************************************
+ * Function: append
+ * Description:
+ *      Adds every flag of a range to the back of the Vector.
+ * Parameters:
+ *      const RANGE& range : Anything with begin() and end()
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+template <typename RANGE>
+void Vector<bool, GROWTH>::append(const RANGE& range)
+{
+    insert(size_, std::begin(range), std::end(range));
+}
+
+/***************************************************************************
+ * Function: erase
+ * Description:
+ *      Removes the flags in the index range [first, last). Everything after
+ *      them is shifted down once, up to 64 flags at a time.
+ * Parameters:
+ *      size_t first : Index of the first flag to remove
+ *      size_t last  : Index one past the last flag to remove
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::erase(size_t first, size_t last)
+{
+    if(first > last || last > size_)
+        throw std::out_of_range("Not a valid range to Erase.");
+
+    if(first == last)
+        return;
+
+    moveBits(last, first, size_ - last);
+    shrinkTo(size_ - (last - first));
+}
+
+/***************************************************************************
+ * Function: erase_if
+ * Description:
+ *      Removes every flag the predicate returns true for, keeping the order
+ *      of the rest. Done in a single compaction pass.
+ * Parameters:
+ *      PREDICATE pred : Called with each flag as a bool, true = remove it
+ * Return:
+ *      size_t : The number of flags removed
+***************************************************************************/
+template <typename GROWTH>
+template <typename PREDICATE>
+size_t Vector<bool, GROWTH>::erase_if(PREDICATE pred)
+{
+    size_t kept = 0;
+    for(size_t index = 0; index < size_; index++)
+    {
+        bool flag = (words_[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+        if(!pred(flag))
+            (*this)[kept++] = flag;
+    }
+
+    size_t removed = size_ - kept;
+    shrinkTo(kept);
+
+    return removed;
+}
+
+/***************************************************************************
+ * Function: pop_back
+ * Description:
+ *      Removes the last flag, clearing its bit.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::pop_back()
+{
+    if(size_ == 0)
+        return;
+
+    size_--;
+    words_[size_ / WORD_BITS] &= ~(uint64_t(1) << (size_ % WORD_BITS));
+}
+
+/***************************************************************************
+ * Function: clear
+ * Description:
+ *      Removes every flag. The words are kept (and zeroed).
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::clear()
+{
+    if(words_)
+        std::memset(words_, 0, wordCount() * sizeof(uint64_t));
+    size_ = 0;
+}
+
+/***************************************************************************
+ * Function: reserve
+ * Description:
+ *      Makes room for at least newCapacity flags.
+ * Parameters:
+ *      size_t newCapacity : number of flags to make room for
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::reserve(size_t newCapacity)
+{
+    if(newCapacity > capacity_)
+        reallocate(wordsFor(newCapacity));
+}
+
+/***************************************************************************
+ * Function: shrink_to_fit
+ * Description:
+ *      Gives back the words that hold no flags.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::shrink_to_fit()
+{
+    if(wordCount() < wordsFor(capacity_))
+        reallocate(wordCount());
+}
+
+/***************************************************************************
+ * Function: assign
+ * Description:
+ *      Replaces the contents with count copies of value. Fills whole words
+ *      with memset, so making a big bitmap costs no more than zeroing it.
+ * Parameters:
+ *      size_t count : number of flags
+ *      bool value   : what to set them all to
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::assign(size_t count, bool value)
+{
+    reserve(count);
+
+    size_ = count;
+    std::memset(words_, value ? 0xFF : 0, wordCount() * sizeof(uint64_t));
+    trimLastWord();
+}
+
+/***************************************************************************
+ * Function: set
+ * Description:
+ *      Sets the flag at the given index.
+ * Parameters:
+ *      size_t index : position of the flag
+ *      bool value   : what to set it to (true by default)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::set(size_t index, bool value)
+{
+    at(index) = value;
+}
+
+/***************************************************************************
+ * Function: flip
+ * Description:
+ *      Flips the flag at the given index.
+ * Parameters:
+ *      size_t index : position of the flag
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::flip(size_t index)
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    words_[index / WORD_BITS] ^= uint64_t(1) << (index % WORD_BITS);
+}
+
+/***************************************************************************
+ * Function: operator&=
+ * Description:
+ *      Keeps only the flags that are also set in other.
+ * Parameters:
+ *      const Vector& other : bitmap of the same size
+ * Return:
+ *      Vector& : this Vector
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>& Vector<bool, GROWTH>::operator&=(const Vector& other)
+{
+    combine(other, BitKernels::Op::AND);
+    return *this;
+}
+
+/***************************************************************************
+ * Function: operator|=
+ * Description:
+ *      Also sets every flag that is set in other.
+ * Parameters:
+ *      const Vector& other : bitmap of the same size
+ * Return:
+ *      Vector& : this Vector
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>& Vector<bool, GROWTH>::operator|=(const Vector& other)
+{
+    combine(other, BitKernels::Op::OR);
+    return *this;
+}
+
+/***************************************************************************
+ * Function: operator^=
+ * Description:
+ *      Flips every flag that is set in other.
+ * Parameters:
+ *      const Vector& other : bitmap of the same size
+ * Return:
+ *      Vector& : this Vector
+***************************************************************************/
+template <typename GROWTH>
+Vector<bool, GROWTH>& Vector<bool, GROWTH>::operator^=(const Vector& other)
+{
+    combine(other, BitKernels::Op::XOR);
+    return *this;
+}
+
+/***************************************************************************
+ * Function: flipAll
+ * Description:
+ *      Flips every flag, a word at a time.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::flipAll()
+{
+    for(size_t index = 0; index < wordCount(); index++)
+        words_[index] = ~words_[index];
+
+    trimLastWord();
+}
+
+/*====================================================================================================================*/
+/* END OF MUTATORS                                                                                                    */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ACCESSORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: count
+ * Description:
+ *      Counts the set flags, with the POPCNT instruction when the CPU has it.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : number of flags that are true
+***************************************************************************/
+template <typename GROWTH>
+size_t Vector<bool, GROWTH>::count() const
+{
+    #ifdef VECTOR_SIMD_X86
+    if(simdLevel() == SimdLevel::AVX2)
+        return BitKernels::popcountAvx2(words_, wordCount());
+    #endif
+    return BitKernels::popcount(words_, wordCount());
+}
+
+/***************************************************************************
+ * Function: findFirst
+ * Description:
+ *      Finds the first flag that is set.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : its index, or size() if no flag is set
+***************************************************************************/
+template <typename GROWTH>
+size_t Vector<bool, GROWTH>::findFirst() const
+{
+    return findNext(0);
+}
+
+/***************************************************************************
+ * Function: findNext
+ * Description:
+ *      Finds the first set flag at or after index. Skips empty words whole
+ *      and finds the bit inside a word with count trailing zeros.
+ * Parameters:
+ *      size_t index : where to start looking
+ * Return:
+ *      size_t : index of the flag, or size() if there is none
+***************************************************************************/
+template <typename GROWTH>
+size_t Vector<bool, GROWTH>::findNext(size_t index) const
+{
+    if(index >= size_)
+        return size_;
+
+    size_t word = index / WORD_BITS;
+    uint64_t bits = words_[word] & (~uint64_t(0) << (index % WORD_BITS));
+
+    while(!bits)
+    {
+        if(++word == wordCount())
+            return size_;
+        bits = words_[word];
+    }
+
+    return word * WORD_BITS + __builtin_ctzll(bits);
+}
+
+/***************************************************************************
+ * Function: front
+ * Description:
+ *      Returns the first flag
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : The first flag
+***************************************************************************/
+template <typename GROWTH>
+bool Vector<bool, GROWTH>::front()
+{
+    return test(0);
+}
+
+/***************************************************************************
+ * Function: back
+ * Description:
+ *      Returns the last flag
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : The last flag
+***************************************************************************/
+template <typename GROWTH>
+bool Vector<bool, GROWTH>::back()
+{
+    return test(size_ - 1);
+}
+
+/***************************************************************************
+ * Function: size
+ * Description:
+ *      Returns the number of flags
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The size of the vector
+***************************************************************************/
+template <typename GROWTH>
+size_t const& Vector<bool, GROWTH>::size() const
+{
+    return size_;
+}
+
+/***************************************************************************
+ * Function: capacity
+ * Description:
+ *      Returns how many flags fit before the Vector has to grow
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : The capacity of the vector
+***************************************************************************/
+template <typename GROWTH>
+size_t const& Vector<bool, GROWTH>::capacity() const
+{
+    return capacity_;
+}
+
+/***************************************************************************
+ * Function: empty
+ * Description:
+ *      Returns whether or not the vector is empty
+ * Parameters:
+ *      None
+ * Return:
+ *      bool : true = vector is empty, false = vector is not empty
+***************************************************************************/
+template <typename GROWTH>
+bool Vector<bool, GROWTH>::empty() const
+{
+    return size_ == 0;
+}
+
+/***************************************************************************
+ * Function: resource
+ * Description:
+ *      Returns the memory resource the words come from.
+ * Parameters:
+ *      None
+ * Return:
+ *      std::pmr::memory_resource* : the resource, nullptr = regular heap
+***************************************************************************/
+template <typename GROWTH>
+std::pmr::memory_resource* Vector<bool, GROWTH>::resource() const
+{
+    return resource_;
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Returns a reference to the flag at the given index, unchecked.
+ * Parameters:
+ *      size_t index : position of the flag, must be < size()
+ * Return:
+ *      BitReference : reads and writes the flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::BitReference Vector<bool, GROWTH>::operator[](size_t index)
+{
+    return BitReference(words_ + index / WORD_BITS, uint64_t(1) << (index % WORD_BITS));
+}
+
+/***************************************************************************
+ * Function: operator[]
+ * Description:
+ *      Returns the flag at the given index, unchecked.
+ * Parameters:
+ *      size_t index : position of the flag, must be < size()
+ * Return:
+ *      bool : the flag
+***************************************************************************/
+template <typename GROWTH>
+bool Vector<bool, GROWTH>::operator[](size_t index) const
+{
+    return (words_[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Returns a reference to the flag at the given index, after checking
+ *      that it's in range.
+ * Parameters:
+ *      size_t index : position of the flag
+ * Return:
+ *      BitReference : reads and writes the flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::BitReference Vector<bool, GROWTH>::at(size_t index)
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return (*this)[index];
+}
+
+/***************************************************************************
+ * Function: at
+ * Description:
+ *      Returns the flag at the given index, after checking that it's in
+ *      range.
+ * Parameters:
+ *      size_t index : position of the flag
+ * Return:
+ *      bool : the flag
+***************************************************************************/
+template <typename GROWTH>
+bool Vector<bool, GROWTH>::at(size_t index) const
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return (*this)[index];
+}
+
+/***************************************************************************
+ * Function: test
+ * Description:
+ *      Same as at(), for reading a flag of a non-const Vector without
+ *      making a BitReference.
+ * Parameters:
+ *      size_t index : position of the flag
+ * Return:
+ *      bool : the flag
+***************************************************************************/
+template <typename GROWTH>
+bool Vector<bool, GROWTH>::test(size_t index) const
+{
+    return at(index);
+}
+
+/***************************************************************************
+ * Function: words
+ * Description:
+ *      Returns the words holding the flags. Flag i is bit i % 64 of word
+ *      i / 64. If you write through it, leave the bits past size() at 0.
+ * Parameters:
+ *      None
+ * Return:
+ *      uint64_t* : the first word
+***************************************************************************/
+template <typename GROWTH>
+uint64_t* Vector<bool, GROWTH>::words()
+{
+    return words_;
+}
+
+/***************************************************************************
+ * Function: words
+ * Description:
+ *      Read only version of words().
+ * Parameters:
+ *      None
+ * Return:
+ *      const uint64_t* : the first word
+***************************************************************************/
+template <typename GROWTH>
+const uint64_t* Vector<bool, GROWTH>::words() const
+{
+    return words_;
+}
+
+/***************************************************************************
+ * Function: wordCount
+ * Description:
+ *      Returns how many words hold flags.
+ * Parameters:
+ *      None
+ * Return:
+ *      size_t : number of words in use
+***************************************************************************/
+template <typename GROWTH>
+size_t Vector<bool, GROWTH>::wordCount() const
+{
+    return wordsFor(size_);
+}
+
+/*====================================================================================================================*/
+/* END OF ACCESSORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* ITERATORS                                                                                                          */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: begin
+ * Description:
+ *      Returns an iterator to the first flag.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator to the first flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::iterator Vector<bool, GROWTH>::begin()
+{
+    return iterator(words_, 0);
+}
+
+/***************************************************************************
+ * Function: end
+ * Description:
+ *      Returns an iterator one past the last flag.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator one past the last flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::iterator Vector<bool, GROWTH>::end()
+{
+    return iterator(words_, size_);
+}
+
+/***************************************************************************
+ * Function: begin
+ * Description:
+ *      Returns a read only iterator to the first flag.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::const_iterator Vector<bool, GROWTH>::begin() const
+{
+    return const_iterator(words_, 0);
+}
+
+/***************************************************************************
+ * Function: end
+ * Description:
+ *      Returns a read only iterator one past the last flag.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator one past the last flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::const_iterator Vector<bool, GROWTH>::end() const
+{
+    return const_iterator(words_, size_);
+}
+
+/***************************************************************************
+ * Function: cbegin
+ * Description:
+ *      Returns a read only iterator to the first flag.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::const_iterator Vector<bool, GROWTH>::cbegin() const
+{
+    return begin();
+}
+
+/***************************************************************************
+ * Function: cend
+ * Description:
+ *      Returns a read only iterator one past the last flag.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator one past the last flag
+***************************************************************************/
+template <typename GROWTH>
+typename Vector<bool, GROWTH>::const_iterator Vector<bool, GROWTH>::cend() const
+{
+    return end();
+}
+
+/*====================================================================================================================*/
+/* END OF ITERATORS                                                                                                   */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* SERIALIZATION                                                                                                      */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: save
+ * Description:
+ *      Writes the flags as a BITMAP: the header, with the number of flags as
+ *      the count, followed by the words that hold them.
+ * Parameters:
+ *      std::ostream& out : stream to write to (open it in binary mode)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::save(std::ostream& out) const
+{
+    writeHeader<bool>(out, ContainerTag::BITMAP, size_);
+    writeBytes(out, words_, wordCount() * sizeof(uint64_t));
+}
+
+/***************************************************************************
+ * Function: load
+ * Description:
+ *      Replaces the flags with a bitmap written by save().
+ * Parameters:
+ *      std::istream& in : stream to read from (open it in binary mode)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::load(std::istream& in)
+{
+    uint64_t count = readHeader<bool>(in, ContainerTag::BITMAP);
+
+    clear();
+    reserve(count);
+    readBytes(in, words_, wordsFor(count) * sizeof(uint64_t));
+    size_ = count;
+    trimLastWord();
+}
+
+/*====================================================================================================================*/
+/* END OF SERIALIZATION                                                                                               */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: resize
+ * Description:
+ *      Grows the Vector by whole words, as the growth policy says.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::resize()
+{
+    reallocate(std::max<size_t>(GROWTH::grow(wordsFor(capacity_), sizeof(uint64_t)), 1));
+}
+
+/***************************************************************************
+ * Function: reallocate
+ * Description:
+ *      Moves the words in use into a new, zeroed buffer of the given size.
+ * Parameters:
+ *      size_t newWordCount : size of the new buffer, in words
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::reallocate(size_t newWordCount)
+{
+    uint64_t* newWords = allocate(newWordCount);
+    size_t used = wordCount();
+
+    if(used)
+        std::memcpy(newWords, words_, used * sizeof(uint64_t));
+    if(newWordCount > used)
+        std::memset(newWords + used, 0, (newWordCount - used) * sizeof(uint64_t));
+
+    deallocate(words_, wordsFor(capacity_));
+    words_ = newWords;
+    capacity_ = newWordCount * WORD_BITS;
+}
+
+/***************************************************************************
+ * Function: combine
+ * Description:
+ *      Runs a bitwise operation over every word of both Vectors.
+ * Parameters:
+ *      const Vector& other : bitmap of the same size
+ *      BitKernels::Op op   : AND, OR or XOR
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::combine(const Vector& other, BitKernels::Op op)
+{
+    if(other.size_ != size_)
+        throw std::invalid_argument("VECTORS MUST BE THE SAME SIZE!");
+
+    #ifdef VECTOR_SIMD_X86
+    if(simdLevel() == SimdLevel::AVX2)
+    {
+        BitKernels::combineAvx2(words_, other.words_, wordCount(), op);
+        return;
+    }
+    #endif
+    BitKernels::combine(words_, other.words_, wordCount(), op);
+}
+
+/***************************************************************************
+ * Function: trimLastWord
+ * Description:
+ *      Clears the bits of the last word that are past size().
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::trimLastWord()
+{
+    if(size_ % WORD_BITS)
+        words_[size_ / WORD_BITS] &= (uint64_t(1) << (size_ % WORD_BITS)) - 1;
+}
+
+/***************************************************************************
+ * Function: readBits
+ * Description:
+ *      Returns the 64 flags starting at any bit, flag bit + i in bit i.
+ *      Bits past the last allocated word read as 0.
+ * Parameters:
+ *      size_t bit : index of the first flag
+ * Return:
+ *      uint64_t : the flags
+***************************************************************************/
+template <typename GROWTH>
+uint64_t Vector<bool, GROWTH>::readBits(size_t bit) const
+{
+    size_t word  = bit / WORD_BITS;
+    size_t shift = bit % WORD_BITS;
+
+    uint64_t bits = words_[word] >> shift;
+    if(shift && word + 1 < wordsFor(capacity_))
+        bits |= words_[word + 1] << (WORD_BITS - shift);
+    return bits;
+}
+
+/***************************************************************************
+ * Function: writeBits
+ * Description:
+ *      Overwrites count flags starting at any bit with the low count bits
+ *      of bits, leaving the flags around them alone.
+ * Parameters:
+ *      size_t bit    : index of the first flag
+ *      uint64_t bits : the new flags
+ *      size_t count  : how many flags, 1 to 64
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::writeBits(size_t bit, uint64_t bits, size_t count)
+{
+    size_t word  = bit / WORD_BITS;
+    size_t shift = bit % WORD_BITS;
+    uint64_t mask = count == WORD_BITS ? ~uint64_t(0) : (uint64_t(1) << count) - 1;
+    bits &= mask;
+
+    words_[word] = (words_[word] & ~(mask << shift)) | (bits << shift);
+    if(shift + count > WORD_BITS)
+    {
+        size_t spill = WORD_BITS - shift;
+        words_[word + 1] = (words_[word + 1] & ~(mask >> spill)) | (bits >> spill);
+    }
+}
+
+/***************************************************************************
+ * Function: moveBits
+ * Description:
+ *      Copies count flags from one position to another, up to 64 at a
+ *      time. Like memmove, it copies back to front when moving up, so the
+ *      two ranges may overlap.
+ * Parameters:
+ *      size_t from  : index of the first flag to move
+ *      size_t to    : index it goes to
+ *      size_t count : how many flags to move
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::moveBits(size_t from, size_t to, size_t count)
+{
+    if(to > from)
+    {
+        while(count > 0)
+        {
+            size_t chunk = std::min(count, WORD_BITS);
+            count -= chunk;
+            writeBits(to + count, readBits(from + count), chunk);
+        }
+    }
+    else if(to < from)
+    {
+        for(size_t done = 0; done < count; done += WORD_BITS)
+            writeBits(to + done, readBits(from + done), std::min(count - done, WORD_BITS));
+    }
+}
+
+/***************************************************************************
+ * Function: shrinkTo
+ * Description:
+ *      Drops the flags past newSize, zeroing their bits so the bulk
+ *      operations can keep working on whole words.
+ * Parameters:
+ *      size_t newSize : the new size, at most size()
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::shrinkTo(size_t newSize)
+{
+    size_t oldWords = wordCount();
+    size_ = newSize;
+
+    if(oldWords > wordCount())
+        std::memset(words_ + wordCount(), 0, (oldWords - wordCount()) * sizeof(uint64_t));
+    trimLastWord();
+}
+
+/***************************************************************************
+ * Function: allocate
+ * Description:
+ *      Grabs raw storage for the given number of words.
+ * Parameters:
+ *      size_t wordCount : number of words
+ * Return:
+ *      uint64_t* : the storage (nullptr if wordCount is 0)
+***************************************************************************/
+template <typename GROWTH>
+uint64_t* Vector<bool, GROWTH>::allocate(size_t wordCount)
+{
+    if(!wordCount)
+        return nullptr;
+
+    if(resource_)
+        return static_cast<uint64_t*>(resource_->allocate(wordCount * sizeof(uint64_t), alignof(uint64_t)));
+
+    return std::allocator<uint64_t>().allocate(wordCount);
+}
+
+/***************************************************************************
+ * Function: deallocate
+ * Description:
+ *      Gives storage obtained from allocate back.
+ * Parameters:
+ *      uint64_t* storage : the storage to free
+ *      size_t wordCount  : number of words it was allocated for
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::deallocate(uint64_t* storage, size_t wordCount)
+{
+    if(!storage)
+        return;
+
+    if(resource_)
+        resource_->deallocate(storage, wordCount * sizeof(uint64_t), alignof(uint64_t));
+    else
+        std::allocator<uint64_t>().deallocate(storage, wordCount);
+}
+
+/***************************************************************************
+ * Function: sameResource
+ * Description:
+ *      Checks whether words from the other Vector can be freed by us.
+ * Parameters:
+ *      const Vector& other : the Vector to compare with
+ * Return:
+ *      bool : true if both use the heap, or equal memory resources
+***************************************************************************/
+template <typename GROWTH>
+bool Vector<bool, GROWTH>::sameResource(const Vector& other) const
+{
+    if(!resource_ || !other.resource_)
+        return resource_ == other.resource_;
+
+    return *resource_ == *other.resource_;
+}
+
+/***************************************************************************
+ * Function: release
+ * Description:
+ *      Frees the words, leaving the Vector empty without any storage.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::release()
+{
+    deallocate(words_, wordsFor(capacity_));
+
+    words_    = nullptr;
+    capacity_ = 0;
+    size_     = 0;
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+
+
+
+
+/*====================================================================================================================*/
+/* EXTRA FUNCTIONS USED FOR TESTING/DEBUGGING                                                                         */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: displayVector
+ * Description:
+ *      Prints out the flags to the console as 0s and 1s.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename GROWTH>
+void Vector<bool, GROWTH>::displayVector()
+{
+    for(size_t index = 0; index < size_; index++)
+        std::cout << test(index) << " ";
+
+    std::cout << std::endl;
+}
+/*====================================================================================================================*/
+/* END OF EXTRA FUNCTIONS                                                                                          */
+/*====================================================================================================================*/
+#endif //VECTOR_BOOL_H
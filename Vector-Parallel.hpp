@@ -0,0 +1,361 @@
+/*************************************************************************************************
+* File: Vector-Parallel.hpp
+* Description:
+*       Parallel versions of the usual algorithms over a Vector, run on a ThreadPool:
+*
+*       parallelForEach   : calls a function on every element
+*       parallelTransform : replaces every element with f(element), or writes f(input[i]) to
+*                           output[i]
+*       parallelReduce    : combines every element with an associative operation
+*       parallelSort      : stable merge sort. The halves are sorted in parallel, and the
+*                           merges are split up too, so the last merge isn't done by one thread.
+*
+*       The work is split in half over and over until a piece has at most `grain` elements,
+*       and each piece is one task. Smaller grains balance the load better, bigger grains
+*       waste less time on scheduling. The default suits cheap per element work.
+*
+*       Requires C++ 17 or later
+*       (If using clang or g++ compiler specify with the flag: -std=c++17 -pthread)
+*
+*       For the STL implementation, refer to the following:
+*       Link: https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef VECTOR_PARALLEL_H
+#define VECTOR_PARALLEL_H
+
+#include "Vector.hpp"
+#include "Thread-Pool.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+// Elements per task unless told otherwise
+constexpr size_t DEFAULT_GRAIN = 16 * 1024;
+
+template <typename DATA, typename GROWTH, typename FUNCTION>
+void parallelForEach(ThreadPool& pool, Vector<DATA, GROWTH>& vector, FUNCTION function, size_t grain = DEFAULT_GRAIN);
+template <typename DATA, typename GROWTH, typename FUNCTION>
+void parallelTransform(ThreadPool& pool, Vector<DATA, GROWTH>& vector, FUNCTION function, size_t grain = DEFAULT_GRAIN);
+template <typename DATA, typename GROWTH, typename RESULT, typename OUT_GROWTH, typename FUNCTION>
+void parallelTransform(ThreadPool& pool, const Vector<DATA, GROWTH>& input, Vector<RESULT, OUT_GROWTH>& output,
+                       FUNCTION function, size_t grain = DEFAULT_GRAIN);
+template <typename DATA, typename GROWTH, typename OPERATION = std::plus<DATA>>
+DATA parallelReduce(ThreadPool& pool, const Vector<DATA, GROWTH>& vector, DATA initial,
+                    OPERATION operation = OPERATION(), size_t grain = DEFAULT_GRAIN);
+template <typename DATA, typename GROWTH, typename COMPARE = std::less<DATA>>
+void parallelSort(ThreadPool& pool, Vector<DATA, GROWTH>& vector, COMPARE compare = COMPARE(), size_t grain = DEFAULT_GRAIN);
+
+/*
+* The pieces the algorithms are built out of. Not meant to be called directly.
+*/
+struct ParallelDetail
+{
+    // Calls body(first, last) on pieces of [first, last) of at most grain indices
+    template <typename BODY>
+    static void forRange(ThreadPool& pool, size_t first, size_t last, size_t grain, const BODY& body);
+
+    // Stable merge of two sorted ranges into output, split across tasks
+    template <typename ITER, typename OUT, typename COMPARE>
+    static void merge(ThreadPool& pool, ITER first1, ITER last1, ITER first2, ITER last2,
+                      OUT output, COMPARE& compare, size_t grain);
+
+    // Sorts [0, count) of `from`. The result lands in `to` if intoTo is set,
+    // otherwise back in `from`. Both arrays start out holding the same elements.
+    template <typename DATA, typename COMPARE>
+    static void sort(ThreadPool& pool, DATA* from, DATA* to, size_t count, bool intoTo,
+                     COMPARE& compare, size_t grain);
+};
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              FUNCTION DEFINITIONS                                                  */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: parallelForEach
+ * Description:
+ *      Calls function(element) on every element of the vector. The calls
+ *      happen in no particular order and on different threads.
+ * Parameters:
+ *      ThreadPool& pool      : pool to run on
+ *      Vector<DATA>& vector  : elements to visit
+ *      FUNCTION function     : called with a DATA& for every element
+ *      size_t grain          : elements per task
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH, typename FUNCTION>
+void parallelForEach(ThreadPool& pool, Vector<DATA, GROWTH>& vector, FUNCTION function, size_t grain)
+{
+    DATA* data = vector.data();
+    ParallelDetail::forRange(pool, 0, vector.size(), grain, [data, &function](size_t first, size_t last)
+    {
+        for(size_t i = first; i < last; i++)
+            function(data[i]);
+    });
+}
+
+/***************************************************************************
+ * Function: parallelTransform
+ * Description:
+ *      Replaces every element with function(element), in parallel.
+ * Parameters:
+ *      ThreadPool& pool      : pool to run on
+ *      Vector<DATA>& vector  : elements to transform
+ *      FUNCTION function     : takes a const DATA&, returns the new DATA
+ *      size_t grain          : elements per task
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH, typename FUNCTION>
+void parallelTransform(ThreadPool& pool, Vector<DATA, GROWTH>& vector, FUNCTION function, size_t grain)
+{
+    parallelForEach(pool, vector, [&function](DATA& element) { element = function(element); }, grain);
+}
+
+/***************************************************************************
+ * Function: parallelTransform
+ * Description:
+ *      Writes function(input[i]) to output[i] for every element, in
+ *      parallel. Output has to be the same size as the input already.
+ * Parameters:
+ *      ThreadPool& pool            : pool to run on
+ *      const Vector<DATA>& input   : elements to read
+ *      Vector<RESULT>& output      : where the results go
+ *      FUNCTION function           : takes a const DATA&, returns a RESULT
+ *      size_t grain                : elements per task
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH, typename RESULT, typename OUT_GROWTH, typename FUNCTION>
+void parallelTransform(ThreadPool& pool, const Vector<DATA, GROWTH>& input, Vector<RESULT, OUT_GROWTH>& output,
+                       FUNCTION function, size_t grain)
+{
+    size_t count = input.cend() - input.cbegin();
+    if(output.size() != count)
+        throw std::invalid_argument("OUTPUT MUST BE THE SAME SIZE AS THE INPUT!");
+
+    const DATA* from = input.data();
+    RESULT* to = output.data();
+    ParallelDetail::forRange(pool, 0, count, grain, [from, to, &function](size_t first, size_t last)
+    {
+        for(size_t i = first; i < last; i++)
+            to[i] = function(from[i]);
+    });
+}
+
+/***************************************************************************
+ * Function: parallelReduce
+ * Description:
+ *      Combines initial and every element with operation. Each task reduces
+ *      its own piece, and the pieces are then combined left to right, so the
+ *      operation has to be associative (but needn't be commutative).
+ * Parameters:
+ *      ThreadPool& pool           : pool to run on
+ *      const Vector<DATA>& vector : elements to combine
+ *      DATA initial               : starting value
+ *      OPERATION operation        : (DATA, DATA) -> DATA, plus by default
+ *      size_t grain               : elements per task
+ * Return:
+ *      DATA : the combined value
+***************************************************************************/
+template <typename DATA, typename GROWTH, typename OPERATION>
+DATA parallelReduce(ThreadPool& pool, const Vector<DATA, GROWTH>& vector, DATA initial, OPERATION operation, size_t grain)
+{
+    const DATA* data = vector.data();
+    size_t count = vector.cend() - vector.cbegin();
+    if(!count)
+        return initial;
+
+    grain = std::max<size_t>(grain, 1);
+    size_t pieces = (count + grain - 1) / grain;
+    std::vector<DATA> partials(pieces, initial);
+
+    ParallelDetail::forRange(pool, 0, pieces, 1, [&](size_t first, size_t last)
+    {
+        for(size_t piece = first; piece < last; piece++)
+        {
+            size_t begin = piece * grain;
+            size_t end   = std::min(begin + grain, count);
+
+            DATA partial = data[begin];
+            for(size_t i = begin + 1; i < end; i++)
+                partial = operation(partial, data[i]);
+            partials[piece] = partial;
+        }
+    });
+
+    DATA result = initial;
+    for(const DATA& partial : partials)
+        result = operation(result, partial);
+    return result;
+}
+
+/***************************************************************************
+ * Function: parallelSort
+ * Description:
+ *      Sorts the vector with a parallel, stable merge sort. Pieces of up to
+ *      grain elements are sorted with std::stable_sort, and then merged
+ *      back together level by level. Takes a copy of the elements as
+ *      scratch space, so DATA has to be copyable.
+ * Parameters:
+ *      ThreadPool& pool      : pool to run on
+ *      Vector<DATA>& vector  : elements to sort
+ *      COMPARE compare       : strict weak ordering, less than by default
+ *      size_t grain          : elements per task
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH, typename COMPARE>
+void parallelSort(ThreadPool& pool, Vector<DATA, GROWTH>& vector, COMPARE compare, size_t grain)
+{
+    size_t count = vector.size();
+    if(count < 2)
+        return;
+
+    std::vector<DATA> scratch(vector.begin(), vector.end());
+    ParallelDetail::sort(pool, vector.data(), scratch.data(), count, false, compare, std::max<size_t>(grain, 2));
+}
+
+/*====================================================================================================================*/
+/* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: forRange
+ * Description:
+ *      Splits [first, last) in half until the pieces have at most grain
+ *      indices. The left half becomes a task, the right half is handled by
+ *      the current thread, so the splitting itself runs in parallel.
+ * Parameters:
+ *      ThreadPool& pool  : pool to run on
+ *      size_t first      : first index
+ *      size_t last       : one past the last index
+ *      size_t grain      : most indices per call to body
+ *      const BODY& body  : called as body(first, last)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename BODY>
+void ParallelDetail::forRange(ThreadPool& pool, size_t first, size_t last, size_t grain, const BODY& body)
+{
+    grain = std::max<size_t>(grain, 1);
+    if(last - first <= grain)
+    {
+        if(first < last)
+            body(first, last);
+        return;
+    }
+
+    size_t middle = first + (last - first) / 2;
+    TaskGroup group(pool);
+    group.run([&pool, first, middle, grain, &body] { forRange(pool, first, middle, grain, body); });
+    forRange(pool, middle, last, grain, body);
+    group.wait();
+}
+
+/***************************************************************************
+ * Function: merge
+ * Description:
+ *      Merges two sorted ranges into output, moving the elements. Big merges
+ *      are split: the middle element of the larger range is found in the
+ *      other with a binary search, which splits both ranges into a part
+ *      that goes before it and a part that goes after it, and those two
+ *      merges run in parallel. Ties keep the first range's elements first.
+ * Parameters:
+ *      ThreadPool& pool          : pool to run on
+ *      ITER first1, last1        : first sorted range
+ *      ITER first2, last2        : second sorted range
+ *      OUT output                : start of the destination
+ *      COMPARE& compare          : ordering used for the sort
+ *      size_t grain              : merges smaller than this aren't split
+ * Return:
+ *      None
+***************************************************************************/
+template <typename ITER, typename OUT, typename COMPARE>
+void ParallelDetail::merge(ThreadPool& pool, ITER first1, ITER last1, ITER first2, ITER last2,
+                           OUT output, COMPARE& compare, size_t grain)
+{
+    size_t size1 = last1 - first1;
+    size_t size2 = last2 - first2;
+    if(size1 + size2 <= grain)
+    {
+        std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                   std::make_move_iterator(first2), std::make_move_iterator(last2), output, compare);
+        return;
+    }
+
+    ITER split1, split2;
+    if(size1 >= size2)
+    {
+        split1 = first1 + size1 / 2;
+        split2 = std::lower_bound(first2, last2, *split1, compare);
+    }
+    else
+    {
+        split2 = first2 + size2 / 2;
+        split1 = std::upper_bound(first1, last1, *split2, compare);
+    }
+
+    OUT splitOutput = output + (split1 - first1) + (split2 - first2);
+
+    TaskGroup group(pool);
+    group.run([&, output] { merge(pool, first1, split1, first2, split2, output, compare, grain); });
+    merge(pool, split1, last1, split2, last2, splitOutput, compare, grain);
+    group.wait();
+}
+
+/***************************************************************************
+ * Function: sort
+ * Description:
+ *      Ping-pong merge sort: sorts both halves so they land in the array we
+ *      are not merging into, then merges them across. Small pieces are
+ *      sorted with std::stable_sort right where the result should go.
+ * Parameters:
+ *      ThreadPool& pool  : pool to run on
+ *      DATA* from        : the elements to sort
+ *      DATA* to          : the scratch copy of the same elements
+ *      size_t count      : number of elements
+ *      bool intoTo       : true = result goes in to, false = back in from
+ *      COMPARE& compare  : ordering to sort by
+ *      size_t grain      : pieces of this size are sorted by one thread
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename COMPARE>
+void ParallelDetail::sort(ThreadPool& pool, DATA* from, DATA* to, size_t count, bool intoTo,
+                          COMPARE& compare, size_t grain)
+{
+    if(count <= grain)
+    {
+        DATA* target = intoTo ? to : from;
+        std::stable_sort(target, target + count, compare);
+        return;
+    }
+
+    size_t half = count / 2;
+    {
+        TaskGroup group(pool);
+        group.run([&] { sort(pool, from, to, half, !intoTo, compare, grain); });
+        sort(pool, from + half, to + half, count - half, !intoTo, compare, grain);
+        group.wait();
+    }
+
+    // The halves are sorted in the other array, merge them into ours
+    DATA* source = intoTo ? from : to;
+    DATA* target = intoTo ? to : from;
+    merge(pool, source, source + half, source + half, source + count, target, compare, grain);
+}
+
+/*====================================================================================================================*/
+/* END OF HELPER FUNCTIONS                                                                                            */
+/*====================================================================================================================*/
+#endif //VECTOR_PARALLEL_H
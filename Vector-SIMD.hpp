@@ -0,0 +1,593 @@
+/*************************************************************************************************
+* File: Vector-SIMD.hpp
+* Description:
+*       Vectorized linear scans over a Vector: find, count, contains, minValue, maxValue and sum.
+*
+*       For Vectors of 32/64 bit signed integers, float and double the loops run 4 to 8 elements
+*       at a time with AVX2, or with SSE2 when the CPU doesn't have AVX2. The choice is made once
+*       at runtime (CPUID), so the same binary runs on both. Any other DATA, or any CPU that
+*       isn't x86, takes the plain scalar loop, so the functions can be used with every Vector.
+*
+*       Things to keep in mind:
+*           - sum() adds the lanes separately, so for float/double the rounding can differ a
+*             little from a front to back loop. Integer sums wrap around on overflow.
+*           - minValue()/maxValue() expect data without NaNs.
+*
+*       Requires C++ 17 or later, and g++ or clang for the vectorized paths
+*       (If using clang or g++ compiler specify with the flag: -std=c++17)
+*
+*       For the intrinsics used, refer to the following:
+*       Link: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html
+**************************************************************************************************/
+
+// INCLUDE GUARDS (You may also see, #pragma once)
+#ifndef VECTOR_SIMD_H
+#define VECTOR_SIMD_H
+
+#include "Vector.hpp"
+#include "Simd-Level.hpp"
+#include <cstdint>
+#include <type_traits>
+#include <stdexcept>
+
+template <typename DATA, typename GROWTH>
+size_t find(const Vector<DATA, GROWTH>& vector, const DATA& value);
+template <typename DATA, typename GROWTH>
+size_t count(const Vector<DATA, GROWTH>& vector, const DATA& value);
+template <typename DATA, typename GROWTH>
+bool contains(const Vector<DATA, GROWTH>& vector, const DATA& value);
+template <typename DATA, typename GROWTH>
+DATA minValue(const Vector<DATA, GROWTH>& vector);
+template <typename DATA, typename GROWTH>
+DATA maxValue(const Vector<DATA, GROWTH>& vector);
+template <typename DATA, typename GROWTH>
+DATA sum(const Vector<DATA, GROWTH>& vector);
+
+/*
+* Maps DATA to the element type the kernels work with, or void if there are no
+* vectorized kernels for it. int and long long both map to the fixed width
+* type of the same size, so e.g. Vector<long long> is vectorized too.
+*/
+template <typename DATA>
+using SimdElement =
+    std::conditional_t<std::is_same<DATA, float>::value,  float,
+    std::conditional_t<std::is_same<DATA, double>::value, double,
+    std::conditional_t<std::is_integral<DATA>::value && std::is_signed<DATA>::value && sizeof(DATA) == 4, int32_t,
+    std::conditional_t<std::is_integral<DATA>::value && std::is_signed<DATA>::value && sizeof(DATA) == 8, int64_t,
+    void>>>>;
+
+/*
+* Plain loops, used for every DATA without vectorized kernels and for the
+* leftover elements at the end of a vectorized loop.
+*/
+struct ScalarKernels
+{
+    template <typename DATA>
+    static size_t find(const DATA* data, size_t count, const DATA& value)
+    {
+        for(size_t i = 0; i < count; i++)
+            if(data[i] == value)
+                return i;
+        return count;
+    }
+
+    template <typename DATA>
+    static size_t count(const DATA* data, size_t count, const DATA& value)
+    {
+        size_t matches = 0;
+        for(size_t i = 0; i < count; i++)
+            if(data[i] == value)
+                matches++;
+        return matches;
+    }
+
+    template <bool MAX, typename DATA>
+    static DATA extreme(const DATA* data, size_t count)
+    {
+        DATA best = data[0];
+        for(size_t i = 1; i < count; i++)
+            if(MAX ? best < data[i] : data[i] < best)
+                best = data[i];
+        return best;
+    }
+
+    template <typename DATA>
+    static DATA sum(const DATA* data, size_t count)
+    {
+        DATA total = DATA();
+        for(size_t i = 0; i < count; i++)
+            total = total + data[i];
+        return total;
+    }
+};
+
+#ifdef VECTOR_SIMD_X86
+
+/*====================================================================================================================*/
+/* SSE2 KERNELS                                                                                                       */
+/*====================================================================================================================*/
+
+/*
+* One struct per element type that wraps the intrinsics the kernels need:
+*   load/store : unaligned 16 byte load/store
+*   set1       : every lane set to the same value
+*   eqMask     : one bit per lane that compared equal
+*   min/max/add: lane by lane
+* MINMAX is false if the instruction set can't do min/max for the type.
+*/
+template <typename T>
+struct Sse2Ops;
+
+template <>
+struct Sse2Ops<int32_t>
+{
+    using reg = __m128i;
+    static constexpr size_t LANES = 4;
+    static constexpr bool MINMAX = true;
+
+    static reg load(const void* p)    { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+    static void store(void* p, reg a) { _mm_storeu_si128(static_cast<__m128i*>(p), a); }
+    static reg set1(int32_t value)    { return _mm_set1_epi32(value); }
+    static int eqMask(reg a, reg b)   { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+    static reg add(reg a, reg b)      { return _mm_add_epi32(a, b); }
+    // SSE2 has no 32 bit min/max, so pick lanes with a compare mask
+    static reg min(reg a, reg b)
+    {
+        reg greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+    static reg max(reg a, reg b)
+    {
+        reg greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+
+template <>
+struct Sse2Ops<int64_t>
+{
+    using reg = __m128i;
+    static constexpr size_t LANES = 2;
+    static constexpr bool MINMAX = false; // No 64 bit compare until SSE4.2
+
+    static reg load(const void* p)    { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+    static void store(void* p, reg a) { _mm_storeu_si128(static_cast<__m128i*>(p), a); }
+    static reg set1(int64_t value)    { return _mm_set1_epi64x(value); }
+    static reg add(reg a, reg b)      { return _mm_add_epi64(a, b); }
+    // Both 32 bit halves have to match, so AND each half with its neighbour
+    static int eqMask(reg a, reg b)
+    {
+        reg equal = _mm_cmpeq_epi32(a, b);
+        equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_movemask_pd(_mm_castsi128_pd(equal));
+    }
+    static reg min(reg a, reg) { return a; }
+    static reg max(reg a, reg) { return a; }
+};
+
+template <>
+struct Sse2Ops<float>
+{
+    using reg = __m128;
+    static constexpr size_t LANES = 4;
+    static constexpr bool MINMAX = true;
+
+    static reg load(const void* p)    { return _mm_loadu_ps(static_cast<const float*>(p)); }
+    static void store(void* p, reg a) { _mm_storeu_ps(static_cast<float*>(p), a); }
+    static reg set1(float value)      { return _mm_set1_ps(value); }
+    static int eqMask(reg a, reg b)   { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static reg add(reg a, reg b)      { return _mm_add_ps(a, b); }
+    static reg min(reg a, reg b)      { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b)      { return _mm_max_ps(a, b); }
+};
+
+template <>
+struct Sse2Ops<double>
+{
+    using reg = __m128d;
+    static constexpr size_t LANES = 2;
+    static constexpr bool MINMAX = true;
+
+    static reg load(const void* p)    { return _mm_loadu_pd(static_cast<const double*>(p)); }
+    static void store(void* p, reg a) { _mm_storeu_pd(static_cast<double*>(p), a); }
+    static reg set1(double value)     { return _mm_set1_pd(value); }
+    static int eqMask(reg a, reg b)   { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+    static reg add(reg a, reg b)      { return _mm_add_pd(a, b); }
+    static reg min(reg a, reg b)      { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b)      { return _mm_max_pd(a, b); }
+};
+
+/*
+* The vectorized loops. Each one handles whole registers of LANES elements and
+* hands whatever is left over to ScalarKernels. DATA is the Vector's type, T is
+* the same sized element type the intrinsics work with.
+*/
+template <typename T>
+struct Sse2Kernels
+{
+    using OPS = Sse2Ops<T>;
+    using reg = typename OPS::reg;
+    static constexpr size_t LANES = OPS::LANES;
+
+    template <typename DATA>
+    static size_t find(const DATA* data, size_t count, const DATA& value)
+    {
+        reg needle = OPS::set1(static_cast<T>(value));
+        size_t i = 0;
+        for(; i + LANES <= count; i += LANES)
+        {
+            int mask = OPS::eqMask(OPS::load(data + i), needle);
+            if(mask)
+                return i + __builtin_ctz(mask);
+        }
+        return i + ScalarKernels::find(data + i, count - i, value);
+    }
+
+    template <typename DATA>
+    static size_t count(const DATA* data, size_t count, const DATA& value)
+    {
+        reg needle = OPS::set1(static_cast<T>(value));
+        size_t matches = 0;
+        size_t i = 0;
+        for(; i + LANES <= count; i += LANES)
+            matches += __builtin_popcount(OPS::eqMask(OPS::load(data + i), needle));
+        return matches + ScalarKernels::count(data + i, count - i, value);
+    }
+
+    // count has to be at least LANES
+    template <bool MAX, typename DATA>
+    static DATA extreme(const DATA* data, size_t count)
+    {
+        reg best = OPS::load(data);
+        size_t i = LANES;
+        for(; i + LANES <= count; i += LANES)
+            best = MAX ? OPS::max(best, OPS::load(data + i)) : OPS::min(best, OPS::load(data + i));
+
+        T lanes[LANES];
+        OPS::store(lanes, best);
+        DATA result = ScalarKernels::extreme<MAX>(lanes, LANES);
+        if(i < count)
+        {
+            DATA tail = ScalarKernels::extreme<MAX>(data + i, count - i);
+            result = (MAX ? result < tail : tail < result) ? tail : result;
+        }
+        return result;
+    }
+
+    template <typename DATA>
+    static DATA sum(const DATA* data, size_t count)
+    {
+        reg total = OPS::set1(T());
+        size_t i = 0;
+        for(; i + LANES <= count; i += LANES)
+            total = OPS::add(total, OPS::load(data + i));
+
+        T lanes[LANES];
+        OPS::store(lanes, total);
+        return ScalarKernels::sum(lanes, LANES) + ScalarKernels::sum(data + i, count - i);
+    }
+};
+
+/*====================================================================================================================*/
+/* END OF SSE2 KERNELS                                                                                                */
+/*====================================================================================================================*/
+
+
+
+/*====================================================================================================================*/
+/* AVX2 KERNELS                                                                                                       */
+/*====================================================================================================================*/
+
+/*
+* Same as the SSE2 versions, on 32 byte registers. Every function is compiled
+* for AVX2 on its own, and is only ever called once simdLevel() says the CPU
+* supports it. The loops are copies of the SSE2 ones because the target has to
+* be set on the loop itself for the intrinsics to be inlined into it.
+*/
+template <typename T>
+struct Avx2Ops;
+
+template <>
+struct Avx2Ops<int32_t>
+{
+    using reg = __m256i;
+    static constexpr size_t LANES = 8;
+    static constexpr bool MINMAX = true;
+
+    AVX2_TARGET static reg load(const void* p)    { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+    AVX2_TARGET static void store(void* p, reg a) { _mm256_storeu_si256(static_cast<__m256i*>(p), a); }
+    AVX2_TARGET static reg set1(int32_t value)    { return _mm256_set1_epi32(value); }
+    AVX2_TARGET static int eqMask(reg a, reg b)   { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+    AVX2_TARGET static reg add(reg a, reg b)      { return _mm256_add_epi32(a, b); }
+    AVX2_TARGET static reg min(reg a, reg b)      { return _mm256_min_epi32(a, b); }
+    AVX2_TARGET static reg max(reg a, reg b)      { return _mm256_max_epi32(a, b); }
+};
+
+template <>
+struct Avx2Ops<int64_t>
+{
+    using reg = __m256i;
+    static constexpr size_t LANES = 4;
+    static constexpr bool MINMAX = true;
+
+    AVX2_TARGET static reg load(const void* p)    { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+    AVX2_TARGET static void store(void* p, reg a) { _mm256_storeu_si256(static_cast<__m256i*>(p), a); }
+    AVX2_TARGET static reg set1(int64_t value)    { return _mm256_set1_epi64x(value); }
+    AVX2_TARGET static int eqMask(reg a, reg b)   { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); }
+    AVX2_TARGET static reg add(reg a, reg b)      { return _mm256_add_epi64(a, b); }
+    // No 64 bit min/max before AVX-512, so pick lanes with a compare mask
+    AVX2_TARGET static reg min(reg a, reg b)      { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    AVX2_TARGET static reg max(reg a, reg b)      { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+};
+
+template <>
+struct Avx2Ops<float>
+{
+    using reg = __m256;
+    static constexpr size_t LANES = 8;
+    static constexpr bool MINMAX = true;
+
+    AVX2_TARGET static reg load(const void* p)    { return _mm256_loadu_ps(static_cast<const float*>(p)); }
+    AVX2_TARGET static void store(void* p, reg a) { _mm256_storeu_ps(static_cast<float*>(p), a); }
+    AVX2_TARGET static reg set1(float value)      { return _mm256_set1_ps(value); }
+    AVX2_TARGET static int eqMask(reg a, reg b)   { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    AVX2_TARGET static reg add(reg a, reg b)      { return _mm256_add_ps(a, b); }
+    AVX2_TARGET static reg min(reg a, reg b)      { return _mm256_min_ps(a, b); }
+    AVX2_TARGET static reg max(reg a, reg b)      { return _mm256_max_ps(a, b); }
+};
+
+template <>
+struct Avx2Ops<double>
+{
+    using reg = __m256d;
+    static constexpr size_t LANES = 4;
+    static constexpr bool MINMAX = true;
+
+    AVX2_TARGET static reg load(const void* p)    { return _mm256_loadu_pd(static_cast<const double*>(p)); }
+    AVX2_TARGET static void store(void* p, reg a) { _mm256_storeu_pd(static_cast<double*>(p), a); }
+    AVX2_TARGET static reg set1(double value)     { return _mm256_set1_pd(value); }
+    AVX2_TARGET static int eqMask(reg a, reg b)   { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+    AVX2_TARGET static reg add(reg a, reg b)      { return _mm256_add_pd(a, b); }
+    AVX2_TARGET static reg min(reg a, reg b)      { return _mm256_min_pd(a, b); }
+    AVX2_TARGET static reg max(reg a, reg b)      { return _mm256_max_pd(a, b); }
+};
+
+template <typename T>
+struct Avx2Kernels
+{
+    using OPS = Avx2Ops<T>;
+    using reg = typename OPS::reg;
+    static constexpr size_t LANES = OPS::LANES;
+
+    template <typename DATA>
+    AVX2_TARGET static size_t find(const DATA* data, size_t count, const DATA& value)
+    {
+        reg needle = OPS::set1(static_cast<T>(value));
+        size_t i = 0;
+        for(; i + LANES <= count; i += LANES)
+        {
+            int mask = OPS::eqMask(OPS::load(data + i), needle);
+            if(mask)
+                return i + __builtin_ctz(mask);
+        }
+        return i + ScalarKernels::find(data + i, count - i, value);
+    }
+
+    template <typename DATA>
+    AVX2_TARGET static size_t count(const DATA* data, size_t count, const DATA& value)
+    {
+        reg needle = OPS::set1(static_cast<T>(value));
+        size_t matches = 0;
+        size_t i = 0;
+        for(; i + LANES <= count; i += LANES)
+            matches += __builtin_popcount(OPS::eqMask(OPS::load(data + i), needle));
+        return matches + ScalarKernels::count(data + i, count - i, value);
+    }
+
+    // count has to be at least LANES
+    template <bool MAX, typename DATA>
+    AVX2_TARGET static DATA extreme(const DATA* data, size_t count)
+    {
+        reg best = OPS::load(data);
+        size_t i = LANES;
+        for(; i + LANES <= count; i += LANES)
+            best = MAX ? OPS::max(best, OPS::load(data + i)) : OPS::min(best, OPS::load(data + i));
+
+        T lanes[LANES];
+        OPS::store(lanes, best);
+        DATA result = ScalarKernels::extreme<MAX>(lanes, LANES);
+        if(i < count)
+        {
+            DATA tail = ScalarKernels::extreme<MAX>(data + i, count - i);
+            result = (MAX ? result < tail : tail < result) ? tail : result;
+        }
+        return result;
+    }
+
+    template <typename DATA>
+    AVX2_TARGET static DATA sum(const DATA* data, size_t count)
+    {
+        reg total = OPS::set1(T());
+        size_t i = 0;
+        for(; i + LANES <= count; i += LANES)
+            total = OPS::add(total, OPS::load(data + i));
+
+        T lanes[LANES];
+        OPS::store(lanes, total);
+        return ScalarKernels::sum(lanes, LANES) + ScalarKernels::sum(data + i, count - i);
+    }
+};
+
+/*====================================================================================================================*/
+/* END OF AVX2 KERNELS                                                                                                */
+/*====================================================================================================================*/
+
+#endif // VECTOR_SIMD_X86
+
+
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*                                              FUNCTION DEFINITIONS                                                  */
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+/*====================================================================================================================*/
+
+/***************************************************************************
+ * Function: find
+ * Description:
+ *      Finds the first element equal to value.
+ * Parameters:
+ *      const Vector<DATA>& vector : Vector to search
+ *      const DATA& value          : value to look for
+ * Return:
+ *      size_t : index of the first match, or the size of the Vector if
+ *               there is none
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+size_t find(const Vector<DATA, GROWTH>& vector, const DATA& value)
+{
+    const DATA* data = vector.data();
+    size_t count = vector.cend() - vector.cbegin();
+
+    #ifdef VECTOR_SIMD_X86
+    if constexpr(!std::is_void<SimdElement<DATA>>::value)
+    {
+        if(simdLevel() == SimdLevel::AVX2)
+            return Avx2Kernels<SimdElement<DATA>>::find(data, count, value);
+        return Sse2Kernels<SimdElement<DATA>>::find(data, count, value);
+    }
+    #endif
+    return ScalarKernels::find(data, count, value);
+}
+
+/***************************************************************************
+ * Function: count
+ * Description:
+ *      Counts the elements equal to value.
+ * Parameters:
+ *      const Vector<DATA>& vector : Vector to search
+ *      const DATA& value          : value to count
+ * Return:
+ *      size_t : number of matches
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+size_t count(const Vector<DATA, GROWTH>& vector, const DATA& value)
+{
+    const DATA* data = vector.data();
+    size_t count = vector.cend() - vector.cbegin();
+
+    #ifdef VECTOR_SIMD_X86
+    if constexpr(!std::is_void<SimdElement<DATA>>::value)
+    {
+        if(simdLevel() == SimdLevel::AVX2)
+            return Avx2Kernels<SimdElement<DATA>>::count(data, count, value);
+        return Sse2Kernels<SimdElement<DATA>>::count(data, count, value);
+    }
+    #endif
+    return ScalarKernels::count(data, count, value);
+}
+
+/***************************************************************************
+ * Function: contains
+ * Description:
+ *      Checks whether any element is equal to value.
+ * Parameters:
+ *      const Vector<DATA>& vector : Vector to search
+ *      const DATA& value          : value to look for
+ * Return:
+ *      bool : true if value was found
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+bool contains(const Vector<DATA, GROWTH>& vector, const DATA& value)
+{
+    return find(vector, value) != static_cast<size_t>(vector.cend() - vector.cbegin());
+}
+
+/***************************************************************************
+ * Function: minValue
+ * Description:
+ *      Returns the smallest element. Throws if the Vector is empty.
+ * Parameters:
+ *      const Vector<DATA>& vector : Vector to search
+ * Return:
+ *      DATA : the smallest element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA minValue(const Vector<DATA, GROWTH>& vector)
+{
+    const DATA* data = vector.data();
+    size_t count = vector.cend() - vector.cbegin();
+    if(!count)
+        throw std::out_of_range("VECTOR IS EMPTY!");
+
+    #ifdef VECTOR_SIMD_X86
+    if constexpr(!std::is_void<SimdElement<DATA>>::value)
+    {
+        using T = SimdElement<DATA>;
+        if(simdLevel() == SimdLevel::AVX2 && count >= Avx2Ops<T>::LANES)
+            return Avx2Kernels<T>::template extreme<false>(data, count);
+        if(Sse2Ops<T>::MINMAX && count >= Sse2Ops<T>::LANES)
+            return Sse2Kernels<T>::template extreme<false>(data, count);
+    }
+    #endif
+    return ScalarKernels::extreme<false>(data, count);
+}
+
+/***************************************************************************
+ * Function: maxValue
+ * Description:
+ *      Returns the largest element. Throws if the Vector is empty.
+ * Parameters:
+ *      const Vector<DATA>& vector : Vector to search
+ * Return:
+ *      DATA : the largest element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA maxValue(const Vector<DATA, GROWTH>& vector)
+{
+    const DATA* data = vector.data();
+    size_t count = vector.cend() - vector.cbegin();
+    if(!count)
+        throw std::out_of_range("VECTOR IS EMPTY!");
+
+    #ifdef VECTOR_SIMD_X86
+    if constexpr(!std::is_void<SimdElement<DATA>>::value)
+    {
+        using T = SimdElement<DATA>;
+        if(simdLevel() == SimdLevel::AVX2 && count >= Avx2Ops<T>::LANES)
+            return Avx2Kernels<T>::template extreme<true>(data, count);
+        if(Sse2Ops<T>::MINMAX && count >= Sse2Ops<T>::LANES)
+            return Sse2Kernels<T>::template extreme<true>(data, count);
+    }
+    #endif
+    return ScalarKernels::extreme<true>(data, count);
+}
+
+/***************************************************************************
+ * Function: sum
+ * Description:
+ *      Adds up every element. An empty Vector sums to DATA().
+ * Parameters:
+ *      const Vector<DATA>& vector : Vector to add up
+ * Return:
+ *      DATA : the total
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA sum(const Vector<DATA, GROWTH>& vector)
+{
+    const DATA* data = vector.data();
+    size_t count = vector.cend() - vector.cbegin();
+
+    #ifdef VECTOR_SIMD_X86
+    if constexpr(!std::is_void<SimdElement<DATA>>::value)
+    {
+        if(simdLevel() == SimdLevel::AVX2)
+            return Avx2Kernels<SimdElement<DATA>>::sum(data, count);
+        return Sse2Kernels<SimdElement<DATA>>::sum(data, count);
+    }
+    #endif
+    return ScalarKernels::sum(data, count);
+}
+
+#endif //VECTOR_SIMD_H
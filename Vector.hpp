@@ -21,16 +21,78 @@
 #include <iostream>
 #include <stdexcept>
 #include <memory>
+#include <new>
 #include <utility>
+#include <type_traits>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+#include <memory_resource>
+#include "Serialization.hpp"
+#if __cplusplus >= 202002L
+#include <span>
+#endif
 
-template<typename DATA>
+/*
+* Growth policies. When a full Vector needs room, it asks its policy for the
+* new capacity. Any type with the same static grow() function can be used.
+*
+*   DoublingGrowth   : 2x. Fewest reallocations, the default.
+*   OneAndHalfGrowth : 1.5x. Wastes less memory, and lets the allocator reuse
+*                      the blocks it freed earlier.
+*   PageGrowth<PAGE> : 2x, but once the buffer is at least a page big it is
+*                      rounded up to whole pages, so no page is left half used.
+*                      HugePageGrowth does the same with 2 MB pages.
+*/
+struct DoublingGrowth
+{
+    static size_t grow(size_t capacity, size_t)
+    {
+        return capacity ? capacity * 2 : 10;
+    }
+};
+
+struct OneAndHalfGrowth
+{
+    static size_t grow(size_t capacity, size_t)
+    {
+        return capacity > 1 ? capacity + capacity / 2 : 10;
+    }
+};
+
+template <size_t PAGE>
+struct PageGrowth
+{
+    static size_t grow(size_t capacity, size_t elementSize)
+    {
+        size_t bytes = DoublingGrowth::grow(capacity, elementSize) * elementSize;
+        if(bytes >= PAGE)
+            bytes = (bytes + PAGE - 1) / PAGE * PAGE;
+        return bytes / elementSize;
+    }
+};
+
+using HugePageGrowth = PageGrowth<2 * 1024 * 1024>;
+
+template<typename DATA, typename GROWTH = DoublingGrowth>
 class Vector
 {
     public:
+        // The elements are contiguous, so plain pointers are our iterators
+        using value_type      = DATA;
+        using const_reference = const DATA&;
+        using iterator        = DATA*;
+        using const_iterator  = const DATA*;
+
         // Default Constructor
         Vector();
         // Overloaded Constructor
         Vector(int);
+        // Constructors that take their memory from the given resource
+        Vector(std::pmr::memory_resource* resource);
+        Vector(int, std::pmr::memory_resource* resource);
         //Destructor
         ~Vector();
         // Copy Constructor
@@ -38,35 +100,95 @@ class Vector
         // Move Constructor
         Vector(Vector&& objectToMove) noexcept;
         // Copy Assignment Operator
-        Vector<DATA>& operator=(const Vector &objectToCopy);
+        Vector<DATA, GROWTH>& operator=(const Vector &objectToCopy);
         // Move Assignment Operator
-        Vector<DATA>& operator=(Vector&& objectToMove) noexcept;
+        Vector<DATA, GROWTH>& operator=(Vector&& objectToMove);
 
         // Mutators
-        void push_back(DATA data);
-        void insertAt(size_t index, DATA data);
+        void push_back(const DATA& data);
+        void push_back(DATA&& data);
+        template <typename... ARGS>
+        DATA& emplace_back(ARGS&&... args);
+        void insertAt(size_t index, const DATA& data);
+        void insertAt(size_t index, DATA&& data);
+        template <typename ITER>
+        void insert(size_t index, ITER first, ITER last);
+        template <typename RANGE>
+        void append(const RANGE& range);
+        void erase(size_t first, size_t last);
+        template <typename PREDICATE>
+        size_t erase_if(PREDICATE pred);
         void clear();
         void pop_back();
+        void reserve(size_t newCapacity);
+        void shrink_to_fit();
 
         // Accessors
         DATA const& front();
         DATA const& back();
-        size_t const& size();
-        size_t const& capacity();
-        bool empty();
+        size_t const& size() const;
+        size_t const& capacity() const;
+        bool empty() const;
+        std::pmr::memory_resource* resource() const;
+        DATA& operator[](size_t index);
+        DATA const& operator[](size_t index) const;
+        DATA& at(size_t index);
+        DATA const& at(size_t index) const;
+        DATA* data();
+        const DATA* data() const;
+
+        // Iterators
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        #if __cplusplus >= 202002L
+        // Views over the live elements, no copy is made
+        operator std::span<DATA>();
+        operator std::span<const DATA>() const;
+        #endif
+
+        // Binary save/load, see Serialization.hpp for the format
+        void save(std::ostream& out) const;
+        void load(std::istream& in);
+
         // Used for testing purposes
         void displayVector();
 
     private:
-        // Main Container
-        std::unique_ptr<DATA[]> array_; 
+        // Where the buffer comes from. nullptr means the regular heap.
+        std::pmr::memory_resource* resource_;
+
+        // Main Container. This is raw, uninitialized storage: only the slots
+        // [0, size_) hold live objects, the rest are constructed on demand.
+        DATA* array_;
 
         // Used to keep track of contents
         size_t capacity_;
         size_t size_;
 
+        // Elements that can be copied byte for byte skip the per element
+        // loops and go through memcpy/memmove instead. If they also don't need
+        // more than malloc's alignment, the buffer comes from malloc so it can
+        // be grown in place with realloc (unless a memory resource is in use).
+        static constexpr bool TRIVIAL = std::is_trivially_copyable<DATA>::value;
+        static constexpr bool REALLOCATABLE = TRIVIAL && alignof(DATA) <= alignof(std::max_align_t);
+
         // Called when expanding Vector
         void resize();
+        size_t grownCapacity() const;
+        // Moves the live elements into a new buffer of the given capacity
+        void reallocate(size_t newCapacity);
+        static void relocate(DATA* from, size_t count, DATA* to);
+        // Raw storage management
+        DATA* allocate(size_t count);
+        void deallocate(DATA* storage, size_t count);
+        bool sameResource(const Vector& other) const;
+        // Destroys the live elements and releases the buffer
+        void release();
 };
 
 
@@ -96,9 +218,39 @@ class Vector
  * Return:
  *      None 
 ***************************************************************************/
-template <typename DATA>
-Vector<DATA>::Vector(int userDefinedCapacity) : 
-array_(new DATA[userDefinedCapacity]), capacity_(userDefinedCapacity), size_(0) {}
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::Vector(int userDefinedCapacity) : Vector(userDefinedCapacity, nullptr) {}
+
+/*************************************************************************** 
+ * Function: Vector
+ * Description:
+ *      Creates a new Vector with a user defined capacity, that gets all of
+ *      its memory from the given memory resource (an arena for example).
+ *      The resource has to outlive the Vector.
+ * Parameters:
+ *      int userDefinedCapacity : initial capacity of the vector.
+ *      std::pmr::memory_resource* resource : where to allocate from.
+ *                                            nullptr = the regular heap.
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::Vector(int userDefinedCapacity, std::pmr::memory_resource* resource) : 
+resource_(resource), array_(allocate(userDefinedCapacity)), capacity_(userDefinedCapacity), size_(0) {}
+
+/*************************************************************************** 
+ * Function: Vector
+ * Description:
+ *      Creates a new Vector with a capacity of 10, that gets all of its
+ *      memory from the given memory resource.
+ * Parameters:
+ *      std::pmr::memory_resource* resource : where to allocate from.
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::Vector(std::pmr::memory_resource* resource) : Vector(10, resource) {}
+
 /*************************************************************************** 
  * Function: Vector (Default Constructor)
  * Description:
@@ -109,29 +261,48 @@ array_(new DATA[userDefinedCapacity]), capacity_(userDefinedCapacity), size_(0)
  * Return:
  *      None 
 ***************************************************************************/
-template <typename DATA>
-Vector<DATA>::Vector() : Vector(10) {}
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::Vector() : Vector(10) {}
 
 /*************************************************************************** 
  * Function: Vector (Copy Constructor)
  * Description:
  *      An overloaded constructor (AKA the copy constructor) that copys the 
  *      contents of a Vector that is already defined, into a new Vector 
- *      object.
+ *      object. Only the live elements are copy constructed, the spare
+ *      capacity is left uninitialized. Like the std::pmr containers, the
+ *      copy doesn't inherit the memory resource, it uses the regular heap.
  * Parameters:
  *      const Vector &objectToCopy : Vector to copy from (Note it's a reference)
  * Return:
  *      None 
 ***************************************************************************/
-template<typename DATA>
-Vector<DATA>::Vector(const Vector &objectToCopy) : 
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::Vector(const Vector &objectToCopy) : 
 
-array_(std::make_unique<DATA[]>(capacity_)), size_(objectToCopy.size_), capacity_(objectToCopy.capacity_)
+resource_(nullptr), array_(allocate(objectToCopy.capacity_)), capacity_(objectToCopy.capacity_), size_(0)
 {
     std::cout << "CSTOR was called...\n";
-    // Copy each element into their respective space
-    for(int index = 0; index < size_; index++)
-        array_[index] = objectToCopy.array_[index];
+    if constexpr(TRIVIAL)
+    {
+        // Copy the whole block in one go
+        if(objectToCopy.size_)
+            std::memcpy(array_, objectToCopy.array_, objectToCopy.size_ * sizeof(DATA));
+        size_ = objectToCopy.size_;
+        return;
+    }
+
+    // Copy construct each element into their respective space
+    try
+    {
+        for(; size_ < objectToCopy.size_; size_++)
+            ::new (static_cast<void*>(array_ + size_)) DATA(objectToCopy.array_[size_]);
+    }
+    catch(...)
+    {
+        release();
+        throw;
+    }
 }
 
 /*************************************************************************** 
@@ -139,40 +310,43 @@ array_(std::make_unique<DATA[]>(capacity_)), size_(objectToCopy.size_), capacity
  * Description:
  *      An overloaded constructor that moves the 
  *      contents of a Vector that is already defined, into a new Vector 
- *      object. The old Vector is reset to a default state.
+ *      object. The old Vector is left empty without any storage, so no
+ *      allocation takes place. The new Vector keeps using the same resource.
  * Parameters:
  *      Vector&& objectToMove : Vector to move contents from
  * Return:
  *      None 
 ***************************************************************************/
-template<typename DATA>
-Vector<DATA>::Vector(Vector&& objectToMove) noexcept :
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::Vector(Vector&& objectToMove) noexcept :
 
-array_   (std::move(objectToMove.array_)), 
-capacity_(std::move(objectToMove.capacity_)),
-size_    (std::move(objectToMove.size_))
+resource_(objectToMove.resource_),
+array_   (objectToMove.array_), 
+capacity_(objectToMove.capacity_),
+size_    (objectToMove.size_)
 {
     std::cout << "Move CSTOR Called...\n";
-    // Set Old Vec to valid state
-    objectToMove.capacity_ = 10;
-    objectToMove.array_ = std::make_unique<DATA[]>(objectToMove.capacity_);
+    // Set Old Vec to valid (empty) state
+    objectToMove.array_ = nullptr;
+    objectToMove.capacity_ = 0;
     objectToMove.size_ = 0;
 }
 
 /*************************************************************************** 
  * Function: ~Vector
  * Description:
- *      The Destructor for the Vector, but serves little purpose as our Smart
- *      pointers will already clean up the memory!
+ *      The Destructor for the Vector. Destroys the live elements and hands
+ *      the raw storage back.
  * Parameters:
  *      None
  * Return:
  *      None 
 ***************************************************************************/
-template <typename DATA>
-Vector<DATA>::~Vector()
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::~Vector()
 { 
     std::cout << "Destrucor was called...\n";
+    release();
 }
 
 /*************************************************************************** 
@@ -185,33 +359,79 @@ Vector<DATA>::~Vector()
  * Return:
  *      None 
 ***************************************************************************/
-template <typename DATA>
-Vector<DATA>& Vector<DATA>::operator=(const Vector<DATA>& objectToCopy)
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>& Vector<DATA, GROWTH>::operator=(const Vector<DATA, GROWTH>& objectToCopy)
 {
     std::cout << "Copy Assign Op Called...\n";
-    // Copy each member variable over into the new object that's being
-    capacity_ = objectToCopy.capacity_;
-    size_ = objectToCopy.size_;
-    array_.reset(new DATA[capacity_]);
+    if(&objectToCopy == this)
+        return *this;
 
-    // Copy each element into their respective space
-    for(auto index = 0; index < size_; index++)
+    // Only go back to the allocator if our current buffer is too small.
+    // We keep our own memory resource.
+    if(objectToCopy.size_ > capacity_)
     {
-        array_[index] = objectToCopy.array_[index];
+        clear();
+        reallocate(objectToCopy.size_);
     }
 
+    if constexpr(TRIVIAL)
+    {
+        if(objectToCopy.size_)
+            std::memcpy(array_, objectToCopy.array_, objectToCopy.size_ * sizeof(DATA));
+        size_ = objectToCopy.size_;
+        return *this;
+    }
+
+    // Assign over the elements we already have, then construct the rest
+    size_t index = 0;
+    for(; index < size_ && index < objectToCopy.size_; index++)
+        array_[index] = objectToCopy.array_[index];
+
+    for(; index < objectToCopy.size_; index++, size_++)
+        ::new (static_cast<void*>(array_ + index)) DATA(objectToCopy.array_[index]);
+
+    // Drop whatever is left over from before
+    while(size_ > objectToCopy.size_)
+        pop_back();
+
     return *this;
 }
 
-template <typename DATA>
-Vector<DATA>& Vector<DATA>::operator=(Vector&& objectToMove) noexcept
+/*************************************************************************** 
+ * Function: operator=
+ * Description:
+ *      The move assignment operator. Releases our own storage, and then takes
+ *      over the buffer of the other Vector, leaving it empty. A buffer from
+ *      a different memory resource can't be taken over, so in that case the
+ *      elements are moved across one by one instead.
+ * Parameters:
+ *      Vector&& objectToMove : Vector to move contents from
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>& Vector<DATA, GROWTH>::operator=(Vector&& objectToMove)
 { 
     std::cout << "Move Assign Op Called...\n";
-    if(&objectToMove != this)
+    if(&objectToMove != this && !sameResource(objectToMove))
     {
-        this->array_    = std::move(objectToMove.array_);
-        this->capacity_ = std::move(objectToMove.capacity_);
-        this->size_     = std::move(objectToMove.size_);
+        clear();
+        reserve(objectToMove.size_);
+        relocate(objectToMove.array_, objectToMove.size_, array_);
+        size_ = objectToMove.size_;
+        objectToMove.clear();
+    }
+    else if(&objectToMove != this)
+    {
+        release();
+
+        this->array_    = objectToMove.array_;
+        this->capacity_ = objectToMove.capacity_;
+        this->size_     = objectToMove.size_;
+
+        objectToMove.array_    = nullptr;
+        objectToMove.capacity_ = 0;
+        objectToMove.size_     = 0;
     }
 
     return *this;   
@@ -229,24 +449,99 @@ Vector<DATA>& Vector<DATA>::operator=(Vector&& objectToMove) noexcept
 /*************************************************************************** 
  * Function: push_back
  * Description:
- *      Pushes an element into the back of the vector.  
+ *      Pushes a copy of an element into the back of the vector.  
  * Parameters:
- *      DATA inputData : The desired element to be placed into the Vector
+ *      const DATA& inputData : The desired element to be placed into the Vector
  * Return:
  *      None 
 ***************************************************************************/
-template <typename DATA>
-void Vector<DATA>::push_back(DATA inputData)
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::push_back(const DATA& inputData)
+{
+    emplace_back(inputData);
+}
+
+/*************************************************************************** 
+ * Function: push_back
+ * Description:
+ *      Moves an element into the back of the vector.  
+ * Parameters:
+ *      DATA&& inputData : The desired element to be placed into the Vector
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::push_back(DATA&& inputData)
+{
+    emplace_back(std::move(inputData));
+}
+
+/*************************************************************************** 
+ * Function: emplace_back
+ * Description:
+ *      Constructs a new element directly in the back of the vector, out of
+ *      the given constructor arguments. No temporary is made.
+ * Parameters:
+ *      ARGS&&... args : Arguments forwarded to DATA's constructor
+ * Return:
+ *      DATA& : The newly constructed element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+template <typename... ARGS>
+DATA& Vector<DATA, GROWTH>::emplace_back(ARGS&&... args)
 {
     // Check to see that if we add another element that we have space
     // In this implementation, we double the capacity only if we try to add to an
     // already full Vector.
-    if(size_ == capacity_)
+    if(size_ < capacity_)
+    {
+        // Construct the new element in the first free slot and, incriment our size variable
+        ::new (static_cast<void*>(array_ + size_)) DATA(std::forward<ARGS>(args)...);
+        return array_[size_++];
+    }
+
+    if constexpr(REALLOCATABLE)
+    {
+        // realloc may move the buffer out from under the arguments, so build
+        // the element first. It's trivially copyable, so this costs a memcpy.
+        DATA element(std::forward<ARGS>(args)...);
         resize();
+        ::new (static_cast<void*>(array_ + size_)) DATA(element);
+        return array_[size_++];
+    }
 
-    // Add new element and, incriment our size variable
-    array_[size_] = inputData;
-    size_++;
+    // We're full. The arguments may refer to one of our own elements, so the
+    // new element is built in the new buffer before the old one is let go.
+    size_t newCapacity = grownCapacity();
+    DATA* tempArr = allocate(newCapacity);
+    try
+    {
+        ::new (static_cast<void*>(tempArr + size_)) DATA(std::forward<ARGS>(args)...);
+    }
+    catch(...)
+    {
+        deallocate(tempArr, newCapacity);
+        throw;
+    }
+
+    try
+    {
+        relocate(array_, size_, tempArr);
+    }
+    catch(...)
+    {
+        tempArr[size_].~DATA();
+        deallocate(tempArr, newCapacity);
+        throw;
+    }
+
+    // Get rid of the old buffer and point to the new one
+    std::destroy(array_, array_ + size_);
+    deallocate(array_, capacity_);
+    array_    = tempArr;
+    capacity_ = newCapacity;
+
+    return array_[size_++];
 }
 
 /*************************************************************************** 
@@ -255,36 +550,257 @@ void Vector<DATA>::push_back(DATA inputData)
  *      Inserts an element at a specific location in the Vector. This 
  *      implementation will push the current contents back to make space, 
  *      instead of overwriting the data, if there is prexisting data.
+ *      Inserting at index size() is the same as a push_back.
+ * Parameters:
+ *      size_t      index     : The location to insert the new element
+ *      const DATA& inputData : The desired element to be placed into the Vector 
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::insertAt(size_t index, const DATA& inputData)
+{
+    // inputData could be one of our own elements, which is about to be
+    // shifted, so take the copy first.
+    insertAt(index, DATA(inputData));
+}
+
+/*************************************************************************** 
+ * Function: insertAt
+ * Description:
+ *      Moves an element into a specific location in the Vector, pushing the
+ *      current contents back to make space.
  * Parameters:
  *      size_t index     : The location to insert the new element
- *      DATA   inputData : The desired element to be placed into the Vector 
+ *      DATA&& inputData : The desired element to be placed into the Vector 
  * Return:
  *      None 
 ***************************************************************************/
-template <typename DATA>
-void Vector<DATA>::insertAt(size_t index, DATA inputData)
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::insertAt(size_t index, DATA&& inputData)
 {
     // Check to see if the index is valid
-    if(index < capacity_ - 1 && index > 0)
+    if(index > size_)
+        throw std::out_of_range("Not a valid Index to Insert.");
+
+    if(index == size_)
     {
-        // Resize the Vector if necessary
-        if(size_ == capacity_)
-            resize();
-
-        // Push the contents of the Vector back to make space
-        for(auto i = size_ + 1; i > index; i--)
-            array_[i] = array_[i - 1];
-        
-        // Finally, insert the value at the desired index
-        array_[index] = inputData;
+        push_back(std::move(inputData));
+        return;
     }
-    else
-        throw std::out_of_range("Not a valid Index to Insert.");
-    
-    // Update counter
+
+    // Resize the Vector if necessary
+    if(size_ == capacity_)
+        resize();
+
+    if constexpr(TRIVIAL)
+    {
+        // Shift the tail back by one slot with a single memmove
+        std::memmove(array_ + index + 1, array_ + index, (size_ - index) * sizeof(DATA));
+        ::new (static_cast<void*>(array_ + index)) DATA(std::move(inputData));
+        size_++;
+        return;
+    }
+
+    // The last element moves into uninitialized storage, so it has to be constructed
+    ::new (static_cast<void*>(array_ + size_)) DATA(std::move(array_[size_ - 1]));
     size_++;
+
+    // Push the rest of the contents of the Vector back to make space
+    for(auto i = size_ - 2; i > index; i--)
+        array_[i] = std::move(array_[i - 1]);
+    
+    // Finally, insert the value at the desired index
+    array_[index] = std::move(inputData);
+}
+
+
+/*************************************************************************** 
+ * Function: insert
+ * Description:
+ *      Inserts the elements [first, last) before position index, in order.
+ *      The tail of the Vector is shifted once by the whole count, and the
+ *      Vector reallocates at most once. The range must not point into this
+ *      Vector. Single pass (input) iterators are appended at the back and
+ *      then rotated into place instead.
+ * Parameters:
+ *      size_t index : The location to insert the new elements (0 : size())
+ *      ITER   first : Start of the elements to insert
+ *      ITER   last  : One past the end of the elements to insert
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+template <typename ITER>
+void Vector<DATA, GROWTH>::insert(size_t index, ITER first, ITER last)
+{
+    // Check to see if the index is valid
+    if(index > size_)
+        throw std::out_of_range("Not a valid Index to Insert.");
+
+    using CATEGORY = typename std::iterator_traits<ITER>::iterator_category;
+    if constexpr(!std::is_base_of<std::forward_iterator_tag, CATEGORY>::value)
+    {
+        // We can't count the elements up front, so add them to the back and
+        // spin them around into position.
+        size_t oldSize = size_;
+        for(; first != last; ++first)
+            emplace_back(*first);
+        std::rotate(array_ + index, array_ + oldSize, array_ + size_);
+        return;
+    }
+    else
+    {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if(count == 0)
+            return;
+
+        size_t tail = size_ - index;
+
+        // Not enough room: build the new buffer around the gap in one pass
+        if(size_ + count > capacity_)
+        {
+            size_t newCapacity = std::max(grownCapacity(), size_ + count);
+            DATA* tempArr = allocate(newCapacity);
+            size_t built = 0;
+            try
+            {
+                for(; first != last; ++first, built++)
+                    ::new (static_cast<void*>(tempArr + index + built)) DATA(*first);
+                relocate(array_, index, tempArr);
+            }
+            catch(...)
+            {
+                std::destroy(tempArr + index, tempArr + index + built);
+                deallocate(tempArr, newCapacity);
+                throw;
+            }
+
+            try
+            {
+                relocate(array_ + index, tail, tempArr + index + count);
+            }
+            catch(...)
+            {
+                std::destroy(tempArr, tempArr + index + count);
+                deallocate(tempArr, newCapacity);
+                throw;
+            }
+
+            std::destroy(array_, array_ + size_);
+            deallocate(array_, capacity_);
+            array_    = tempArr;
+            capacity_ = newCapacity;
+            size_    += count;
+            return;
+        }
+
+        if constexpr(TRIVIAL)
+        {
+            // Open the gap with a single memmove and copy the range in
+            std::memmove(array_ + index + count, array_ + index, tail * sizeof(DATA));
+            for(DATA* slot = array_ + index; first != last; ++first, ++slot)
+                ::new (static_cast<void*>(slot)) DATA(*first);
+            size_ += count;
+            return;
+        }
+
+        DATA* oldEnd = array_ + size_;
+        if(count <= tail)
+        {
+            // The last 'count' elements move into uninitialized storage, the
+            // rest of the tail is shifted over live elements.
+            std::uninitialized_move(oldEnd - count, oldEnd, oldEnd);
+            size_ += count;
+            std::move_backward(array_ + index, oldEnd - count, oldEnd);
+            std::copy(first, last, array_ + index);
+        }
+        else
+        {
+            // The range reaches past the old end: the part of it that lands
+            // there is constructed, and the tail moves right behind it.
+            ITER middle = first;
+            std::advance(middle, tail);
+            std::uninitialized_copy(middle, last, oldEnd);
+            size_ += count - tail;
+            std::uninitialized_move(array_ + index, oldEnd, array_ + index + count);
+            size_ += tail;
+            std::copy(first, middle, array_ + index);
+        }
+    }
+}
+
+/*************************************************************************** 
+ * Function: append
+ * Description:
+ *      Adds every element of a range (anything with begin() and end()) to
+ *      the back of the Vector, growing at most once.
+ * Parameters:
+ *      const RANGE& range : The elements to add
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+template <typename RANGE>
+void Vector<DATA, GROWTH>::append(const RANGE& range)
+{
+    insert(size_, std::begin(range), std::end(range));
+}
+
+/*************************************************************************** 
+ * Function: erase
+ * Description:
+ *      Removes the elements in the index range [first, last). Everything
+ *      after them is shifted down once.
+ * Parameters:
+ *      size_t first : Index of the first element to remove
+ *      size_t last  : Index one past the last element to remove
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::erase(size_t first, size_t last)
+{
+    if(first > last || last > size_)
+        throw std::out_of_range("Not a valid range to Erase.");
+
+    if(first == last)
+        return;
+
+    if constexpr(TRIVIAL)
+    {
+        std::memmove(array_ + first, array_ + last, (size_ - last) * sizeof(DATA));
+        size_ -= last - first;
+        return;
+    }
+
+    DATA* newEnd = std::move(array_ + last, array_ + size_, array_ + first);
+    std::destroy(newEnd, array_ + size_);
+    size_ = newEnd - array_;
 }
 
+/*************************************************************************** 
+ * Function: erase_if
+ * Description:
+ *      Removes every element the predicate returns true for, keeping the
+ *      order of the rest. Done in a single compaction pass.
+ * Parameters:
+ *      PREDICATE pred : Called with each element, true = remove it
+ * Return:
+ *      size_t : The number of elements removed
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+template <typename PREDICATE>
+size_t Vector<DATA, GROWTH>::erase_if(PREDICATE pred)
+{
+    DATA* newEnd = std::remove_if(array_, array_ + size_, pred);
+    size_t removed = (array_ + size_) - newEnd;
+
+    std::destroy(newEnd, array_ + size_);
+    size_ -= removed;
+
+    return removed;
+}
 
 /*************************************************************************** 
  * Function: pop_back
@@ -295,31 +811,65 @@ void Vector<DATA>::insertAt(size_t index, DATA inputData)
  * Return:
  *      None 
 ***************************************************************************/
-template<typename DATA>
-void Vector<DATA>::pop_back()
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::pop_back()
 {
-    // Remove back element in Vector
+    // Remove back element in Vector, and destroy it
     size_--;
+    array_[size_].~DATA();
 }
 
 /*************************************************************************** 
- * Function: pop_back
+ * Function: clear
  * Description:
- *      Removes the element at the back of the vector.
+ *      Removes every element in the vector. The capacity is kept, so the
+ *      Vector can be refilled without going back to the allocator.
  * Parameters:
  *      None
  * Return:
  *      None 
 ***************************************************************************/
-template<typename DATA>
-void Vector<DATA>::clear()
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::clear()
 {
-    // Call the reset method to release the old memory, and allocate new memory
-     array_.reset(new DATA[10]);
+    // Destroy the live elements, but hold on to the memory
+    std::destroy(array_, array_ + size_);
 
-     // Reset the counter variables
-     capacity_ = 10;
-     size_ = 0;
+    // Reset the counter variable
+    size_ = 0;
+}
+
+/*************************************************************************** 
+ * Function: reserve
+ * Description:
+ *      Makes sure the Vector can hold at least newCapacity elements without
+ *      having to grow again. Never shrinks the Vector.
+ * Parameters:
+ *      size_t newCapacity : The minimum capacity wanted
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::reserve(size_t newCapacity)
+{
+    if(newCapacity > capacity_)
+        reallocate(newCapacity);
+}
+
+/*************************************************************************** 
+ * Function: shrink_to_fit
+ * Description:
+ *      Gives back any unused capacity, so that capacity() == size().
+ * Parameters:
+ *      None
+ * Return:
+ *      None 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::shrink_to_fit()
+{
+    if(size_ < capacity_)
+        reallocate(size_);
 }
 /*====================================================================================================================*/
 /* END OF MODIFIERS                                                                                                   */
@@ -341,8 +891,8 @@ void Vector<DATA>::clear()
  * Return:
  *      DATA : The front element in the vector 
 ***************************************************************************/
-template<typename DATA>
-DATA const& Vector<DATA>::front()
+template <typename DATA, typename GROWTH>
+DATA const& Vector<DATA, GROWTH>::front()
 {
     return array_[0];
 }
@@ -356,8 +906,8 @@ DATA const& Vector<DATA>::front()
  * Return:
  *      DATA : The back element in the vector 
 ***************************************************************************/
-template<typename DATA>
-DATA const& Vector<DATA>::back()
+template <typename DATA, typename GROWTH>
+DATA const& Vector<DATA, GROWTH>::back()
 {
     return array_[size_ - 1];
 }
@@ -371,8 +921,8 @@ DATA const& Vector<DATA>::back()
  * Return:
  *      size_t : The size of the vector 
 ***************************************************************************/
-template<typename DATA>
-size_t const& Vector<DATA>::size()
+template <typename DATA, typename GROWTH>
+size_t const& Vector<DATA, GROWTH>::size() const
 {
     return size_;
 }
@@ -386,8 +936,8 @@ size_t const& Vector<DATA>::size()
  * Return:
  *      size_t : The capacity of the vector 
 ***************************************************************************/
-template<typename DATA>
-size_t const& Vector<DATA>::capacity()
+template <typename DATA, typename GROWTH>
+size_t const& Vector<DATA, GROWTH>::capacity() const
 {
     return capacity_;
 }
@@ -401,12 +951,251 @@ size_t const& Vector<DATA>::capacity()
  * Return:
  *      bool : true = vector is empty, false = vector is not empty 
 ***************************************************************************/
-template<typename DATA>
-bool Vector<DATA>::empty()
+template <typename DATA, typename GROWTH>
+bool Vector<DATA, GROWTH>::empty() const
 {
     return (size_ > 0) ? false : true;
 }
 
+/*************************************************************************** 
+ * Function: resource
+ * Description:
+ *      Returns the memory resource the vector allocates from
+ * Parameters:
+ *      None
+ * Return:
+ *      std::pmr::memory_resource* : the resource, nullptr = regular heap 
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+std::pmr::memory_resource* Vector<DATA, GROWTH>::resource() const
+{
+    return resource_;
+}
+
+/*************************************************************************** 
+ * Function: operator[]
+ * Description:
+ *      Returns the element at the given index. The index is not checked,
+ *      use at() for that.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA& Vector<DATA, GROWTH>::operator[](size_t index)
+{
+    return array_[index];
+}
+
+/*************************************************************************** 
+ * Function: operator[]
+ * Description:
+ *      Read only version of operator[] for const Vectors.
+ * Parameters:
+ *      size_t index : position of the element, must be < size()
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA const& Vector<DATA, GROWTH>::operator[](size_t index) const
+{
+    return array_[index];
+}
+
+/*************************************************************************** 
+ * Function: at
+ * Description:
+ *      Returns the element at the given index, after checking that it's in
+ *      range.
+ * Parameters:
+ *      size_t index : position of the element
+ * Return:
+ *      DATA& : the element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA& Vector<DATA, GROWTH>::at(size_t index)
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return array_[index];
+}
+
+/*************************************************************************** 
+ * Function: at
+ * Description:
+ *      Read only version of at() for const Vectors.
+ * Parameters:
+ *      size_t index : position of the element
+ * Return:
+ *      DATA const& : the element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA const& Vector<DATA, GROWTH>::at(size_t index) const
+{
+    if(index >= size_)
+        throw std::out_of_range("INDEX OUT OF RANGE!");
+
+    return array_[index];
+}
+
+/*************************************************************************** 
+ * Function: data
+ * Description:
+ *      Returns a pointer to the first element. The elements are stored back
+ *      to back, so [data(), data() + size()) can be handed to anything that
+ *      takes a plain array. May be nullptr if there is no buffer.
+ * Parameters:
+ *      None
+ * Return:
+ *      DATA* : pointer to the first element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA* Vector<DATA, GROWTH>::data()
+{
+    return array_;
+}
+
+/*************************************************************************** 
+ * Function: data
+ * Description:
+ *      Read only version of data() for const Vectors.
+ * Parameters:
+ *      None
+ * Return:
+ *      const DATA* : pointer to the first element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+const DATA* Vector<DATA, GROWTH>::data() const
+{
+    return array_;
+}
+
+/*************************************************************************** 
+ * Function: begin
+ * Description:
+ *      Returns an iterator to the first element. Any operation that grows
+ *      or shrinks the buffer invalidates it.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator to the first element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename Vector<DATA, GROWTH>::iterator Vector<DATA, GROWTH>::begin()
+{
+    return array_;
+}
+
+/*************************************************************************** 
+ * Function: end
+ * Description:
+ *      Returns an iterator one past the last element.
+ * Parameters:
+ *      None
+ * Return:
+ *      iterator : iterator one past the last element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename Vector<DATA, GROWTH>::iterator Vector<DATA, GROWTH>::end()
+{
+    return array_ + size_;
+}
+
+/*************************************************************************** 
+ * Function: begin
+ * Description:
+ *      Read only version of begin() for const Vectors.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename Vector<DATA, GROWTH>::const_iterator Vector<DATA, GROWTH>::begin() const
+{
+    return array_;
+}
+
+/*************************************************************************** 
+ * Function: end
+ * Description:
+ *      Read only version of end() for const Vectors.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator one past the last element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename Vector<DATA, GROWTH>::const_iterator Vector<DATA, GROWTH>::end() const
+{
+    return array_ + size_;
+}
+
+/*************************************************************************** 
+ * Function: cbegin
+ * Description:
+ *      Returns a read only iterator to the first element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator to the first element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename Vector<DATA, GROWTH>::const_iterator Vector<DATA, GROWTH>::cbegin() const
+{
+    return array_;
+}
+
+/*************************************************************************** 
+ * Function: cend
+ * Description:
+ *      Returns a read only iterator one past the last element.
+ * Parameters:
+ *      None
+ * Return:
+ *      const_iterator : iterator one past the last element
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+typename Vector<DATA, GROWTH>::const_iterator Vector<DATA, GROWTH>::cend() const
+{
+    return array_ + size_;
+}
+
+#if __cplusplus >= 202002L
+/*************************************************************************** 
+ * Function: operator std::span
+ * Description:
+ *      Views the live elements as a std::span (C++ 20). Nothing is copied,
+ *      and the span is invalidated along with the iterators.
+ * Parameters:
+ *      None
+ * Return:
+ *      std::span<DATA> : view over [data(), data() + size())
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::operator std::span<DATA>()
+{
+    return std::span<DATA>(array_, size_);
+}
+
+/*************************************************************************** 
+ * Function: operator std::span
+ * Description:
+ *      Read only view over the live elements of a const Vector (C++ 20).
+ * Parameters:
+ *      None
+ * Return:
+ *      std::span<const DATA> : view over [data(), data() + size())
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+Vector<DATA, GROWTH>::operator std::span<const DATA>() const
+{
+    return std::span<const DATA>(array_, size_);
+}
+#endif
+
 /*====================================================================================================================*/
 /* END OF ACCESSORS                                                                                                   */
 /*====================================================================================================================*/
@@ -414,6 +1203,74 @@ bool Vector<DATA>::empty()
 
 
 
+/*====================================================================================================================*/
+/* SERIALIZATION                                                                                                      */
+/*====================================================================================================================*/
+
+/*************************************************************************** 
+ * Function: save
+ * Description:
+ *      Writes the vector to a binary stream. Trivially copyable elements
+ *      are written straight out of the buffer with one call.
+ * Parameters:
+ *      std::ostream& out : stream to write to (open it in binary mode)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::save(std::ostream& out) const
+{
+    writeHeader<DATA>(out, ContainerTag::VECTOR, size_);
+
+    if constexpr(TRIVIAL)
+        writeBytes(out, array_, size_ * sizeof(DATA));
+    else
+        for(size_t index = 0; index < size_; index++)
+            writeElement(out, array_[index]);
+}
+
+/*************************************************************************** 
+ * Function: load
+ * Description:
+ *      Replaces the contents of the vector with a vector written by save().
+ *      Makes room for every element up front, and reads trivially copyable
+ *      elements straight into the buffer with one call.
+ * Parameters:
+ *      std::istream& in : stream to read from (open it in binary mode)
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::load(std::istream& in)
+{
+    uint64_t count = readHeader<DATA>(in, ContainerTag::VECTOR);
+
+    clear();
+    reserve(count);
+
+    if constexpr(TRIVIAL)
+    {
+        readBytes(in, array_, count * sizeof(DATA));
+        size_ = count;
+    }
+    else
+    {
+        for(uint64_t index = 0; index < count; index++)
+        {
+            DATA element;
+            readElement(in, element);
+            emplace_back(std::move(element));
+        }
+    }
+}
+
+/*====================================================================================================================*/
+/* END OF SERIALIZATION                                                                                               */
+/*====================================================================================================================*/
+
+
+
+
 /*====================================================================================================================*/
 /* HELPER FUNCTIONS (NOT TO BE EXPLICITLY CALLED)                                                                     */
 /*====================================================================================================================*/
@@ -421,28 +1278,218 @@ bool Vector<DATA>::empty()
 /*************************************************************************** 
  * Function: resize
  * Description:
- *      Creates a temporary vector with double the capacity of the original,
- *      and then copies the contents over.
+ *      Grows the capacity of the Vector as the GROWTH policy says (doubles it
+ *      by default). An empty Vector (such as one that was moved from) starts
+ *      over at the default capacity of 10.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::resize()
+{
+    reallocate(grownCapacity());
+}
+
+/*************************************************************************** 
+ * Function: grownCapacity
+ * Description:
+ *      Returns the capacity the Vector should have after growing once, as
+ *      picked by the GROWTH policy.
  * Parameters:
  *      None
  * Return:
+ *      size_t : the next capacity
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+size_t Vector<DATA, GROWTH>::grownCapacity() const
+{
+    return GROWTH::grow(capacity_, sizeof(DATA));
+}
+
+/*************************************************************************** 
+ * Function: reallocate
+ * Description:
+ *      Creates a new raw buffer with the given capacity, and relocates the
+ *      contents over. Elements are moved if their move constructor can't
+ *      throw, otherwise they are copied so a failure leaves us untouched.
+ *      Buffers that came from malloc are handed to realloc instead, which
+ *      can often grow them in place (or remap the pages for large ones).
+ * Parameters:
+ *      size_t newCapacity : capacity of the new buffer (must be >= size_)
+ * Return:
  *      None
 ***************************************************************************/
-template <typename DATA>
-void Vector<DATA>::resize()
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::reallocate(size_t newCapacity)
 {
-    // create a temporary Array that's double the capacity
-    std::unique_ptr<DATA[]> tempArr (new DATA[capacity_ * 2]);
+    if constexpr(REALLOCATABLE)
+    {
+        if(!resource_ && array_ && newCapacity)
+        {
+            void* grown = std::realloc(array_, newCapacity * sizeof(DATA));
+            if(!grown)
+                throw std::bad_alloc();
 
-    // Load the temporary array with what we have now
-    for(auto index = 0; index < size_; index++)
-        tempArr[index] = array_[index];
+            array_    = static_cast<DATA*>(grown);
+            capacity_ = newCapacity;
+            return;
+        }
+    }
+
+    // create a temporary raw buffer, nothing is constructed in it yet
+    DATA* tempArr = allocate(newCapacity);
+
+    // Load the temporary buffer with what we have now
+    try
+    {
+        relocate(array_, size_, tempArr);
+    }
+    catch(...)
+    {
+        deallocate(tempArr, newCapacity);
+        throw;
+    }
 
-    // Reassign the class array to pointer to the new array's address
-    array_ = std::move(tempArr);
+    // Get rid of the old buffer and point to the new one
+    std::destroy(array_, array_ + size_);
+    deallocate(array_, capacity_);
+    array_ = tempArr;
 
     // Update the capacity
-    capacity_ *= 2;
+    capacity_ = newCapacity;
+}
+
+/*************************************************************************** 
+ * Function: relocate
+ * Description:
+ *      Constructs count elements in the raw storage 'to' out of the ones in
+ *      'from'. Elements are moved if that can't throw, and copied otherwise.
+ *      If a constructor throws, whatever was built in 'to' is destroyed and
+ *      'from' is left as it was. The source elements are not destroyed.
+ *      Trivially copyable elements are copied with a single memcpy.
+ * Parameters:
+ *      DATA*  from  : the live elements to relocate
+ *      size_t count : number of elements
+ *      DATA*  to    : uninitialized destination storage
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::relocate(DATA* from, size_t count, DATA* to)
+{
+    if constexpr(TRIVIAL)
+    {
+        if(count)
+            std::memcpy(to, from, count * sizeof(DATA));
+        return;
+    }
+
+    size_t index = 0;
+    try
+    {
+        for(; index < count; index++)
+            ::new (static_cast<void*>(to + index)) DATA(std::move_if_noexcept(from[index]));
+    }
+    catch(...)
+    {
+        std::destroy(to, to + index);
+        throw;
+    }
+}
+
+/*************************************************************************** 
+ * Function: allocate
+ * Description:
+ *      Grabs raw storage for count elements from the memory resource, or the
+ *      heap if there is none. No constructors are run.
+ * Parameters:
+ *      size_t count : number of elements the storage should fit
+ * Return:
+ *      DATA* : pointer to the storage (nullptr if count is 0)
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+DATA* Vector<DATA, GROWTH>::allocate(size_t count)
+{
+    if(!count)
+        return nullptr;
+
+    if(resource_)
+        return static_cast<DATA*>(resource_->allocate(count * sizeof(DATA), alignof(DATA)));
+
+    if constexpr(REALLOCATABLE)
+    {
+        void* storage = std::malloc(count * sizeof(DATA));
+        if(!storage)
+            throw std::bad_alloc();
+        return static_cast<DATA*>(storage);
+    }
+    else
+        return std::allocator<DATA>().allocate(count);
+}
+
+/*************************************************************************** 
+ * Function: deallocate
+ * Description:
+ *      Gives raw storage obtained from allocate back. No destructors are run.
+ * Parameters:
+ *      DATA*  storage : the storage to free
+ *      size_t count   : number of elements it was allocated for
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::deallocate(DATA* storage, size_t count)
+{
+    if(!storage)
+        return;
+
+    if(resource_)
+        resource_->deallocate(storage, count * sizeof(DATA), alignof(DATA));
+    else if constexpr(REALLOCATABLE)
+        std::free(storage);
+    else
+        std::allocator<DATA>().deallocate(storage, count);
+}
+
+/*************************************************************************** 
+ * Function: sameResource
+ * Description:
+ *      Checks whether memory from the other Vector can be freed by us.
+ * Parameters:
+ *      const Vector& other : the Vector to compare with
+ * Return:
+ *      bool : true if both use the heap, or equal memory resources
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+bool Vector<DATA, GROWTH>::sameResource(const Vector& other) const
+{
+    if(!resource_ || !other.resource_)
+        return resource_ == other.resource_;
+
+    return *resource_ == *other.resource_;
+}
+
+/*************************************************************************** 
+ * Function: release
+ * Description:
+ *      Destroys every live element and frees the buffer, leaving the Vector
+ *      empty without any storage.
+ * Parameters:
+ *      None
+ * Return:
+ *      None
+***************************************************************************/
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::release()
+{
+    std::destroy(array_, array_ + size_);
+    deallocate(array_, capacity_);
+
+    array_    = nullptr;
+    capacity_ = 0;
+    size_     = 0;
 }
 
 /*====================================================================================================================*/
@@ -465,8 +1512,8 @@ void Vector<DATA>::resize()
  * Return:
  *      None
 ***************************************************************************/
-template<typename DATA>
-void Vector<DATA>::displayVector()
+template <typename DATA, typename GROWTH>
+void Vector<DATA, GROWTH>::displayVector()
 {
     for(auto index = 0; index < size_; index++)
         std::cout << array_[index] << " ";
@@ -476,4 +1523,7 @@ void Vector<DATA>::displayVector()
 /*====================================================================================================================*/
 /* END OF EXTRA FUNCTIONS                                                                                          */
 /*====================================================================================================================*/
+
+// Vector<bool> packs its flags into bits, see Vector-Bool.hpp
+#include "Vector-Bool.hpp"
 #endif //DATASTRUCTURES_VECTOR_H
@@ -2,19 +2,752 @@
 #include "Vector.hpp"
 #include "Binary-Search-Tree.hpp"
 #include <ctime> // time(...)
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <thread>
+
+#ifdef STACK_LIST_TEST
+#include "Stack_ListBased.hpp"
+#include "Queue_ListBased.hpp"
+// Both stacks are called Stack, so the Vector based one goes in its own namespace. Vector.hpp
+// is already included, so this only adds the Stack itself.
+namespace VectorBased
+{
+#include "Stack_VectorBased.hpp"
+}
+#endif // STACK_LIST_TEST
+
+#ifdef ALLOCATION_TEST
+#include "SmallVector.hpp"
+#include <iterator>
+#include <sstream>
+#endif // ALLOCATION_TEST
+
+#ifdef UNROLLED_TEST
+#include "Unrolled-Linked-List.hpp"
+#include <list>
+#endif // UNROLLED_TEST
+
+#ifdef LAYOUT_TEST
+#include <memory>
+#endif // LAYOUT_TEST
+
+#ifdef TEARDOWN_TEST
+#include <memory>
+#include <forward_list>
+#endif // TEARDOWN_TEST
+
+#ifdef CONCURRENT_SLL_TEST
+#include "Concurrent-Linked-List.hpp"
+#endif // CONCURRENT_SLL_TEST
+
+#ifdef PARALLEL_TEST
+#include "Vector-Parallel.hpp"
+#endif // PARALLEL_TEST
+
+#ifdef GROWTH_TEST
+#include "IncrementalVector.hpp"
+#endif // GROWTH_TEST
+
+#ifdef SIMD_TEST
+#include "Vector-SIMD.hpp"
+#endif // SIMD_TEST
+
+#ifdef TRIVIAL_TEST
+#include <type_traits>
+#endif // TRIVIAL_TEST
+
+#ifdef MAPPED_TEST
+#include "MappedVector.hpp"
+#include <fstream>
+#include <cstdio>
+#endif // MAPPED_TEST
+
+#ifdef SKIPLIST_TEST
+#include "Skip-List.hpp"
+#include <map>
+#include <sstream>
+#endif // SKIPLIST_TEST
+
+#ifdef SOA_TEST
+#include "SoAVector.hpp"
+#endif // SOA_TEST
+
+#ifdef COW_TEST
+#include "CowVector.hpp"
+#include <type_traits>
+#endif // COW_TEST
 
 /*
 * Set Macro definitions in command line. The makefile provided
 *   already will do this. See the makefile to configure specific tests.
 */
 
+// Seconds one call of function takes, for the benchmarks below
+template <typename FUNCTION>
+double timeIt(FUNCTION&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Prints the outcome of one check
+inline void check(const std::string& what, bool passed)
+{
+    std::cout << what << ": " << (passed ? "PASSED" : "FAILED") << "\n";
+}
+
+#if defined(VECTOR_TEST) || defined(SLL_TEST) || defined(STACK_LIST_TEST) || defined(ALLOCATION_TEST)
+// Payload that counts how it gets made, to check that emplace_* builds the element in place
+// (one construction, nothing copied or moved) and that the && overloads move instead of copy
+struct Counted
+{
+    static inline int constructions = 0;
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    int first;
+    int second;
+
+    Counted(int a = 0, int b = 0) : first(a), second(b) { constructions++; }
+    Counted(const Counted& other) : first(other.first), second(other.second) { copies++; }
+    Counted(Counted&& other) noexcept : first(other.first), second(other.second) { moves++; }
+    Counted& operator=(const Counted& other) { first = other.first; second = other.second; copies++; return *this; }
+    Counted& operator=(Counted&& other) noexcept { first = other.first; second = other.second; moves++; return *this; }
+
+    static void reset() { constructions = copies = moves = 0; }
+
+    // Prints what one call did against what it should have done, then resets
+    static void check(const char* call, int expectedConstructions, int expectedCopies, int expectedMoves)
+    {
+        bool passed = constructions == expectedConstructions && copies == expectedCopies && moves == expectedMoves;
+        std::cout << call << " EXPECTED: " << expectedConstructions << " built, " << expectedCopies << " copied, "
+                  << expectedMoves << " moved RECIEVED: " << constructions << " built, " << copies << " copied, "
+                  << moves << " moved " << (passed ? "PASSED" : "FAILED") << "\n";
+        reset();
+    }
+};
+#endif
+
+#ifdef ALLOCATION_TEST
+// Every operator new in the program goes through here, so a benchmark can count how often a
+// container went to the heap. Containers of non trivially copyable elements (like Counted)
+// allocate through std::allocator, and std::pmr::new_delete_resource() through the aligned
+// form, which both end up here.
+static size_t heapAllocations = 0;
+
+void* operator new(size_t bytes)
+{
+    heapAllocations++;
+    if(void* memory = std::malloc(bytes ? bytes : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+void* operator new(size_t bytes, std::align_val_t alignment)
+{
+    heapAllocations++;
+    size_t align = static_cast<size_t>(alignment);
+    if(void* memory = std::aligned_alloc(align, (bytes + align - 1) / align * align))
+        return memory;
+    throw std::bad_alloc();
+}
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+#endif // ALLOCATION_TEST
+
+#ifdef GROWTH_TEST
+// Element that keeps count of how many of it are alive, to catch leaked or twice destroyed
+// elements when IncrementalVector moves them between buffers
+struct Tracked
+{
+    static inline long alive = 0;
+    long value;
+
+    Tracked(long v = 0) : value(v) { alive++; }
+    Tracked(const Tracked& other) : value(other.value) { alive++; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { alive++; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { alive--; }
+};
+#endif // GROWTH_TEST
+
+#ifdef TRIVIAL_TEST
+// An int with hand written copy and move constructors. That's enough to make it not trivially
+// copyable, so Vector has to move it element by element instead of using memcpy/realloc
+struct Boxed
+{
+    int value;
+
+    Boxed(int v = 0) : value(v) {}
+    Boxed(const Boxed& other) : value(other.value) {}
+    Boxed(Boxed&& other) noexcept : value(other.value) {}
+    Boxed& operator=(const Boxed& other) { value = other.value; return *this; }
+    Boxed& operator=(Boxed&& other) noexcept { value = other.value; return *this; }
+    operator int() const { return value; }
+};
+#endif // TRIVIAL_TEST
+
+#ifdef ITERATOR_TEST
+#include <iterator>
+#include <type_traits>
+#endif // ITERATOR_TEST
+
+#ifdef RELINK_TEST
+#include <forward_list>
+
+// Ordered and compared by key only, so the tag shows whether equal elements kept their order
+struct Keyed
+{
+    int key;
+    int tag;
+
+    bool operator<(const Keyed& other) const { return key < other.key; }
+    bool operator==(const Keyed& other) const { return key == other.key; }
+};
+
+// Same elements in the same order, tags included
+template <typename LIST>
+bool sameOrder(const LIST& list, const std::vector<Keyed>& expected)
+{
+    return std::equal(list.begin(), list.end(), expected.begin(), expected.end(),
+                      [](const Keyed& lhs, const Keyed& rhs) { return lhs.key == rhs.key && lhs.tag == rhs.tag; });
+}
+#endif // RELINK_TEST
+
+#ifdef UNROLLED_TEST
+// Elements of an UnrolledSLL front to back. There are no iterators, so a copy is emptied
+template <size_t K>
+std::vector<int> contents(const UnrolledSLL<int, K>& list)
+{
+    UnrolledSLL<int, K> copy(list);
+    std::vector<int> elements;
+    while(copy.size())
+    {
+        elements.push_back(copy.front());
+        copy.pop_front();
+    }
+    return elements;
+}
+
+// Runs the same random inserts and removes on an UnrolledSLL<int, K> and a std::list. With a
+// small K nearly every insert splits a chunk and nearly every remove merges two.
+template <size_t K>
+void checkChunkSize()
+{
+    UnrolledSLL<int, K> list;
+    std::list<int> reference;
+    std::mt19937 random(19 + K);
+    bool matches = true, chunks = true;
+
+    for(int step = 0; step < 2000 && matches; step++)
+    {
+        int value = step;
+        size_t size = reference.size();
+        switch(size < 2 ? 0 : random() % 5)
+        {
+            case 0:
+                list.push_front(value);
+                reference.push_front(value);
+                break;
+            case 1:
+            {
+                size_t index = random() % size;
+                list.insert_after(value, int(index));
+                reference.insert(std::next(reference.begin(), index + 1), value);
+                break;
+            }
+            case 2:
+            {
+                // After a Position found by search()
+                int after = *std::next(reference.begin(), random() % size);
+                list.insert_after(value, list.search(after));
+                reference.insert(std::next(std::find(reference.begin(), reference.end(), after)), value);
+                break;
+            }
+            case 3:
+            {
+                size_t index = random() % (size - 1);
+                list.remove_after(int(index));
+                reference.erase(std::next(reference.begin(), index + 1));
+                break;
+            }
+            default:
+                list.pop_front();
+                reference.pop_front();
+                break;
+        }
+
+        // Grows for the first half, then mostly shrinks, so both splits and merges happen a lot
+        if(step > 1000 && reference.size() > 1 && random() % 3)
+        {
+            list.remove_after(0);
+            reference.erase(std::next(reference.begin()));
+        }
+
+        matches = list.size() == reference.size() && contents(list) == std::vector<int>(reference.begin(), reference.end()) &&
+                  (reference.empty() || (list.front() == reference.front() && list.back() == reference.back()));
+        // No empty chunks, and never more than one chunk per element
+        chunks = chunks && list.chunkCount() >= (list.size() + K - 1) / K && list.chunkCount() <= list.size();
+    }
+    check("K = " + std::to_string(K) + " matches std::list", matches);
+    check("K = " + std::to_string(K) + " chunk count stays in range", chunks);
+}
+
+template <size_t... K>
+void checkChunkSizes(std::index_sequence<K...>)
+{
+    (checkChunkSize<K + 1>(), ...);
+}
+#endif // UNROLLED_TEST
+
 int main(int argc, char** argv)
 {
     // Vector Test Section
     #ifdef VECTOR_TEST
-    
+    {
+        std::cout << "\nVECTOR COPY/MOVE COUNTS\n";
+        Vector<Counted> counted;
+        counted.reserve(16); // so growing doesn't move anything
+        Counted element(1, 2);
+        Counted::reset();
+
+        counted.emplace_back(3, 4);
+        Counted::check("emplace_back(3, 4)", 1, 0, 0);
+        counted.push_back(Counted(5, 6));
+        Counted::check("push_back(Counted&&)", 1, 0, 1);
+        counted.push_back(element);
+        Counted::check("push_back(const Counted&)", 0, 1, 0);
+    }
     #endif // VECTOR_TEST
 
+    // Vector<bool> Test Section
+    #ifdef BITSET_TEST
+    {
+        std::cout << "\nVECTOR<BOOL> AGAINST std::vector<bool>\n";
+        auto same = [](const Vector<bool>& bits, const std::vector<bool>& reference)
+        {
+            return bits.size() == reference.size() && std::equal(bits.begin(), bits.end(), reference.begin(), reference.end());
+        };
+        std::mt19937 random(16);
+        auto coin = [&]() { return bool(random() & 1); };
+
+        // Random edits, most of them around the 64 bit word boundaries, where the shifting
+        // between words happens
+        Vector<bool> bits;
+        std::vector<bool> reference;
+        for(int i = 0; i < 200; i++)
+        {
+            bool value = coin();
+            bits.push_back(value);
+            reference.push_back(value);
+        }
+        auto nearBoundary = [&](size_t limit)
+        {
+            size_t word = random() % (limit / 64 + 1);
+            size_t index = word * 64 + (random() % 5) - 2;
+            return std::min(index, limit);
+        };
+
+        bool inserts = true, erases = true, ranges = true, edits = true;
+        for(int step = 0; step < 3000; step++)
+        {
+            switch(random() % 6)
+            {
+                case 0:
+                {
+                    size_t index = nearBoundary(reference.size());
+                    bool value = coin();
+                    bits.insertAt(index, value);
+                    reference.insert(reference.begin() + index, value);
+                    inserts = inserts && same(bits, reference);
+                    break;
+                }
+                case 1:
+                {
+                    if(reference.empty())
+                        break;
+                    size_t first = nearBoundary(reference.size() - 1);
+                    size_t last = std::min(reference.size(), first + random() % 130);
+                    bits.erase(first, last);
+                    reference.erase(reference.begin() + first, reference.begin() + last);
+                    erases = erases && same(bits, reference);
+                    break;
+                }
+                case 2:
+                {
+                    // A run of 0..199 flags, so some inserts shift by whole words and some don't
+                    std::vector<bool> run(random() % 200);
+                    for(size_t i = 0; i < run.size(); i++)
+                        run[i] = coin();
+                    size_t index = nearBoundary(reference.size());
+                    bits.insert(index, run.begin(), run.end());
+                    reference.insert(reference.begin() + index, run.begin(), run.end());
+                    ranges = ranges && same(bits, reference);
+                    break;
+                }
+                case 3:
+                {
+                    if(reference.empty())
+                        break;
+                    size_t index = random() % reference.size();
+                    bits.flip(index);
+                    reference[index] = !reference[index];
+                    index = random() % reference.size();
+                    bool value = coin();
+                    bits[index] = value;
+                    reference[index] = value;
+                    edits = edits && same(bits, reference);
+                    break;
+                }
+                case 4:
+                {
+                    if(reference.empty())
+                        break;
+                    bits.pop_back();
+                    reference.pop_back();
+                    edits = edits && same(bits, reference);
+                    break;
+                }
+                default:
+                {
+                    // Drops every third flag, which is never word aligned
+                    size_t position = 0, removed = 0;
+                    std::vector<bool> kept;
+                    for(bool value : reference)
+                        if(position++ % 3 != 2)
+                            kept.push_back(value);
+                    position = 0;
+                    removed = bits.erase_if([&](bool) { return position++ % 3 == 2; });
+                    erases = erases && removed == reference.size() - kept.size() && same(bits, kept);
+                    reference = kept;
+                    break;
+                }
+            }
+            // Keeps the size in a range where every case has something to work on
+            while(reference.size() < 100)
+            {
+                bool value = coin();
+                bits.push_back(value);
+                reference.push_back(value);
+            }
+            while(reference.size() > 2000)
+            {
+                bits.erase(reference.size() - 500, reference.size());
+                reference.resize(reference.size() - 500);
+            }
+        }
+        check("insertAt() across word boundaries", inserts);
+        check("insert() of a run across word boundaries", ranges);
+        check("erase() and erase_if() across word boundaries", erases);
+        check("flip(), [] and pop_back()", edits);
+
+        // Bitmap operations on sizes that end partway through a word. After flipAll() the count
+        // would be off if a bit past the end had been set in the last word.
+        bool bitwise = true, counts = true, finds = true;
+        for(size_t size : {size_t(1), size_t(63), size_t(64), size_t(65), size_t(127), size_t(128), size_t(1000)})
+        {
+            Vector<bool> lhs, rhs;
+            std::vector<bool> left(size), right(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                left[i] = coin();
+                right[i] = random() % 4 == 0;
+                lhs.push_back(left[i]);
+                rhs.push_back(right[i]);
+            }
+
+            Vector<bool> result;
+            std::vector<bool> expected(size);
+            result = lhs;
+            result &= rhs;
+            for(size_t i = 0; i < size; i++)
+                expected[i] = left[i] && right[i];
+            bitwise = bitwise && same(result, expected);
+            result = lhs;
+            result |= rhs;
+            for(size_t i = 0; i < size; i++)
+                expected[i] = left[i] || right[i];
+            bitwise = bitwise && same(result, expected);
+            result = lhs;
+            result ^= rhs;
+            for(size_t i = 0; i < size; i++)
+                expected[i] = left[i] != right[i];
+            bitwise = bitwise && same(result, expected);
+
+            size_t ones = std::count(right.begin(), right.end(), true);
+            counts = counts && rhs.count() == ones;
+            rhs.flipAll();
+            counts = counts && rhs.count() == size - ones;
+            rhs.flipAll();
+
+            // findFirst/findNext visit exactly the set flags, in order (findNext looks at or after
+            // the index it's given)
+            std::vector<size_t> found, wanted;
+            for(size_t index = rhs.findFirst(); index < size; index = rhs.findNext(index + 1))
+                found.push_back(index);
+            for(size_t i = 0; i < size; i++)
+                if(right[i])
+                    wanted.push_back(i);
+            finds = finds && found == wanted;
+        }
+        check("&=, |= and ^=", bitwise);
+        check("count() and flipAll() with a partial last word", counts);
+        check("findFirst() and findNext()", finds);
+
+        Vector<bool> filled;
+        filled.assign(130, true);
+        filled.set(64, false);
+        check("assign(), set() and test()",
+              filled.size() == 130 && filled.count() == 129 && !filled.test(64) && filled.test(63) && filled.test(129));
+    }
+    #endif // BITSET_TEST
+
+    // Allocation Count Test Section
+    #ifdef ALLOCATION_TEST
+    {
+        // BENCHMARK: grow to 100000 elements the way Vector used to (new DATA[2 * capacity]
+        // default constructs every slot, then every element is copy assigned across) and the way
+        // it does now (raw storage, elements moved across and built only when pushed)
+        const int COUNT = 100000;
+        struct Row { const char* name; int built, copied, moved; size_t allocations; double time; };
+        std::vector<Row> rows;
+        auto measure = [&](const char* name, auto&& grow)
+        {
+            Counted::reset();
+            size_t before = heapAllocations;
+            double time = timeIt(grow);
+            rows.push_back({name, Counted::constructions, Counted::copies, Counted::moves, heapAllocations - before, time});
+        };
+
+        measure("new DATA[] + copy", [&]()
+        {
+            size_t capacity = 10, size = 0;
+            Counted* array = new Counted[capacity];
+            for(int i = 0; i < COUNT; i++)
+            {
+                if(size == capacity)
+                {
+                    Counted* grown = new Counted[capacity * 2];
+                    for(size_t j = 0; j < size; j++)
+                        grown[j] = array[j];
+                    delete[] array;
+                    array = grown;
+                    capacity *= 2;
+                }
+                array[size++] = Counted(i, i);
+            }
+            delete[] array;
+        });
+
+        Vector<Counted> pushed;
+        measure("Vector push_back", [&]() { for(int i = 0; i < COUNT; i++) pushed.push_back(Counted(i, i)); });
+        Vector<Counted> emplaced;
+        measure("Vector emplace_back", [&]() { for(int i = 0; i < COUNT; i++) emplaced.emplace_back(i, i); });
+        Vector<Counted> reserved;
+        measure("reserve + emplace_back", [&]() { reserved.reserve(COUNT); for(int i = 0; i < COUNT; i++) reserved.emplace_back(i, i); });
+
+        std::cout << "\nGROWING TO " << COUNT << " ELEMENTS\n";
+        std::cout << "SCHEME\t\t\tBUILT\tCOPIED\tMOVED\tALLOCATIONS\tTIME\n";
+        for(const Row& row : rows)
+            std::cout << row.name << (std::string(row.name).size() < 16 ? "\t\t" : "\t") << row.built << "\t" << row.copied << "\t"
+                      << row.moved << "\t" << row.allocations << "\t\t" << row.time * 1000 << "ms\n";
+
+        // The paths that used to allocate a fresh 10 slot array. The counts are taken before
+        // check(), which allocates a std::string of its own.
+        size_t before = heapAllocations;
+        pushed.clear();
+        size_t clearing = heapAllocations - before;
+        check("clear() doesn't allocate", clearing == 0 && pushed.capacity() >= size_t(COUNT));
+
+        before = heapAllocations;
+        Vector<Counted> taken(std::move(emplaced));
+        size_t moving = heapAllocations - before;
+        check("the move constructor doesn't allocate", moving == 0 && taken.size() == size_t(COUNT));
+
+        reserved.erase(10, reserved.size());
+        Counted::reset();
+        before = heapAllocations;
+        reserved.shrink_to_fit();
+        size_t shrinking = heapAllocations - before;
+        check("shrink_to_fit() allocates once and only moves the survivors",
+              shrinking == 1 && reserved.capacity() == 10 && Counted::moves == 10 && Counted::copies == 0);
+
+        // SmallVector builds the new element straight into the next buffer when it's full, even
+        // when the argument is one of its own elements, inline or already on the heap
+        SmallVector<Counted, 4> small;
+        for(int i = 0; i < 4; i++)
+            small.emplace_back(i, i);
+        Counted::reset();
+        small.emplace_back(4, 4);
+        Counted::check("SmallVector emplace_back(4, 4) when full inline", 1, 0, 4);
+        for(int i = 5; i < 8; i++)
+            small.emplace_back(i, i);
+        Counted::reset();
+        small.emplace_back(8, 8);
+        Counted::check("SmallVector emplace_back(8, 8) when full on the heap", 1, 0, 8);
+
+        SmallVector<std::string, 4> names;
+        for(int i = 0; i < 4; i++)
+            names.push_back("a string too long for the small string buffer " + std::to_string(i));
+        names.push_back(names[0]);
+        bool inlineAlias = !names.isInline() && names.size() == 5 && names[4] == names[0] && names[0].back() == '0';
+        for(int i = 5; i < 8; i++)
+            names.push_back(names[i - 1]);
+        names.emplace_back(names.back());
+        check("SmallVector push_back/emplace_back of its own element when full", inlineAlias &&
+              names.size() == 9 && names.capacity() == 16 && names.at(8) == names[0]);
+
+        // insert/erase/erase_if against std::vector, with the inserts crossing out of the
+        // inline buffer
+        SmallVector<std::string, 4> edited;
+        std::vector<std::string> expected;
+        const std::vector<std::string> words = {"one", "two", "three", "four", "five"};
+        edited.insert(0, words.begin(), words.begin() + 3);
+        expected.insert(expected.begin(), words.begin(), words.begin() + 3);
+        edited.insert(1, words.begin(), words.end());
+        expected.insert(expected.begin() + 1, words.begin(), words.end());
+        edited.append(words);
+        expected.insert(expected.end(), words.begin(), words.end());
+        edited.erase(2, 6);
+        expected.erase(expected.begin() + 2, expected.begin() + 6);
+        size_t removed = edited.erase_if([](const std::string& word) { return word.size() == 3; });
+        size_t expectedRemoved = expected.size();
+        expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                      [](const std::string& word) { return word.size() == 3; }), expected.end());
+        expectedRemoved -= expected.size();
+        const SmallVector<std::string, 4>& readOnly = edited;
+        bool threw = false;
+        try { readOnly.at(readOnly.size()); } catch(const std::out_of_range&) { threw = true; }
+        check("SmallVector insert/append/erase/erase_if match std::vector",
+              std::equal(readOnly.begin(), readOnly.end(), expected.begin(), expected.end()) &&
+              removed == expectedRemoved && readOnly.data() == &readOnly[0] && threw);
+
+        SmallVector<int, 4> numbers;
+        std::istringstream input("1 2 3 4 5");
+        numbers.push_back(0);
+        numbers.push_back(6);
+        numbers.insert(1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+        numbers.erase(0, 1);
+        check("SmallVector insert from an input iterator, trivial erase",
+              std::vector<int>(numbers.cbegin(), numbers.cend()) == std::vector<int>({1, 2, 3, 4, 5, 6}));
+
+        // BENCHMARK: 100000 short lived containers of a few elements each, like per request
+        // temporaries. Vector allocates its 10 slots up front (and again when it outgrows them),
+        // SmallVector<Counted, 16> only goes to the heap past 16 elements.
+        const int OBJECTS = 100000;
+        std::cout << "\nSHORT LIVED CONTAINERS (" << OBJECTS << " of each size)\n";
+        std::cout << "ELEMENTS\tVECTOR ALLOCS\tSMALLVECTOR ALLOCS\tVECTOR TIME\tSMALLVECTOR TIME\n";
+        for(int elements : {4, 12, 16, 32})
+        {
+            volatile long sink = 0;
+            // Vector prints a line from every constructor and destructor, which would swamp the
+            // timing; a stream in a failed state drops the output without doing any work
+            std::cout.setstate(std::ios::badbit);
+            size_t before = heapAllocations;
+            double vectorTime = timeIt([&]()
+            {
+                for(int object = 0; object < OBJECTS; object++)
+                {
+                    Vector<Counted> temporary;
+                    for(int i = 0; i < elements; i++)
+                        temporary.emplace_back(i, object);
+                    sink = sink + temporary.back().second;
+                }
+            });
+            size_t vectorAllocations = heapAllocations - before;
+
+            before = heapAllocations;
+            double smallTime = timeIt([&]()
+            {
+                for(int object = 0; object < OBJECTS; object++)
+                {
+                    SmallVector<Counted, 16> temporary;
+                    for(int i = 0; i < elements; i++)
+                        temporary.emplace_back(i, object);
+                    sink = sink + temporary.back().second;
+                }
+            });
+            size_t smallAllocations = heapAllocations - before;
+            std::cout.clear();
+
+            std::cout << elements << "\t\t" << vectorAllocations << "\t\t" << smallAllocations << "\t\t\t"
+                      << vectorTime * 1000 << "ms\t" << smallTime * 1000 << "ms\n";
+        }
+
+        // BENCHMARK: allocation throughput of the memory resources. First raw 32 byte blocks,
+        // 1000 at a time, then 10000 "requests" that each build an SLL and a Vector of 100 ints
+        // and throw them away. The arena is released after every batch/request, which is the
+        // point of it: one release instead of a deallocate per block. The one heap allocation
+        // per request left on the pools is the Vector's last 640 byte buffer, which is over
+        // PoolResource::MAX_BLOCK; on the arena it's the first chunk, since release() gives
+        // every chunk back.
+        const int BLOCKS = 1000;
+        const int ROUNDS = 1000;
+        const int REQUESTS = 10000;
+        ArenaResource arena;
+        PoolResource pool;
+        struct Resource { const char* name; std::pmr::memory_resource* resource; ArenaResource* arena; };
+        const Resource RESOURCES[] = {{"new_delete_resource", std::pmr::new_delete_resource(), nullptr},
+                                      {"PoolResource\t", &pool, nullptr},
+                                      {"ArenaResource\t", &arena, &arena},
+                                      {"NodePoolResource", &NodePoolResource::instance(), nullptr}};
+
+        std::cout << "\nMEMORY RESOURCE THROUGHPUT\n";
+        std::cout << "RESOURCE\t\tBLOCKS/s\tREQUESTS/s\tHEAP ALLOCS PER REQUEST\n";
+        std::vector<void*> blocks(BLOCKS);
+        for(const Resource& row : RESOURCES)
+        {
+            double blockTime = timeIt([&]()
+            {
+                for(int round = 0; round < ROUNDS; round++)
+                {
+                    for(void*& block : blocks)
+                        block = row.resource->allocate(32, 8);
+                    for(void* block : blocks)
+                        row.resource->deallocate(block, 32, 8);
+                    if(row.arena)
+                        row.arena->release();
+                }
+            });
+
+            volatile long sink = 0;
+            std::cout.setstate(std::ios::badbit); // silences Vector's constructor/destructor lines
+            size_t before = heapAllocations;
+            double requestTime = timeIt([&]()
+            {
+                for(int request = 0; request < REQUESTS; request++)
+                {
+                    {
+                        SLL<int> list(row.resource);
+                        Vector<int> vector(row.resource);
+                        for(int i = 0; i < 100; i++)
+                        {
+                            list.push_front(i);
+                            vector.push_back(i);
+                        }
+                        sink = sink + list.front() + vector.back();
+                    }
+                    if(row.arena)
+                        row.arena->release();
+                }
+            });
+            size_t requestAllocations = heapAllocations - before;
+            std::cout.clear();
+
+            std::cout << row.name << "\t" << BLOCKS * ROUNDS / blockTime / 1e6 << "M\t\t" << REQUESTS / requestTime / 1e3 << "K\t\t"
+                      << double(requestAllocations) / REQUESTS << "\n";
+        }
+    }
+    #endif // ALLOCATION_TEST
+
     // SLL Test Section
     #ifdef SLL_TEST
     SLL<int> myList;
@@ -42,8 +775,1576 @@ int main(int argc, char** argv)
     std::cout << "RESULT:";
     myList.print();
 
+    {
+        std::cout << "\nSLL COPY/MOVE COUNTS\n";
+        SLL<Counted> counted;
+        Counted element(1, 2);
+        Counted::reset();
+
+        counted.emplace_front(3, 4);
+        Counted::check("emplace_front(3, 4)", 1, 0, 0);
+        counted.emplace_after(0, 5, 6);
+        Counted::check("emplace_after(int, 5, 6)", 1, 0, 0);
+        counted.emplace_after(counted.before_begin(), 7, 8);
+        Counted::check("emplace_after(Node*, 7, 8)", 1, 0, 0);
+        counted.push_front(std::move(element));
+        Counted::check("push_front(Counted&&)", 0, 0, 1);
+        counted.insert_after(Counted(9, 10), 0);
+        Counted::check("insert_after(Counted&&, int)", 1, 0, 1);
+        counted.insert_after(Counted(11, 12), counted.before_begin());
+        Counted::check("insert_after(Counted&&, Node*)", 1, 0, 1);
+        counted.push_front(element);
+        Counted::check("push_front(const Counted&)", 0, 1, 0);
+    }
+
     #endif // SLL_TEST
 
+    // SLL Iterator Test Section
+    #ifdef ITERATOR_TEST
+    {
+        std::cout << "\nSLL ITERATORS\n";
+        using Iterator = SLL<int>::iterator;
+        using ConstIterator = SLL<int>::const_iterator;
+        static_assert(std::is_same<std::iterator_traits<Iterator>::iterator_category, std::forward_iterator_tag>::value,
+                      "SLL iterators are forward iterators");
+        static_assert(std::is_same<std::iterator_traits<ConstIterator>::reference, const int&>::value,
+                      "a const_iterator only reads");
+        static_assert(std::is_convertible<Iterator, ConstIterator>::value && !std::is_convertible<ConstIterator, Iterator>::value,
+                      "an iterator converts to a const_iterator, not back");
+
+        SLL<int> empty;
+        check("an empty list has begin() == end()", empty.begin() == empty.end() && empty.prefetched(8).begin() == empty.end());
+
+        SLL<int> list;
+        for(int i = 100; i >= 1; i--)
+            list.push_front(i);
+        const SLL<int>& readOnly = list;
+        check("range-for visits every element in order", [&]()
+        {
+            int expected = 1;
+            for(int element : list)
+                if(element != expected++)
+                    return false;
+            return expected == 101;
+        }());
+        check("works with <algorithm>", std::accumulate(list.begin(), list.end(), 0) == 5050 &&
+              std::is_sorted(readOnly.begin(), readOnly.end()) && *std::find(list.cbegin(), list.cend(), 42) == 42 &&
+              std::count_if(list.begin(), list.end(), [](int element) { return element % 10 == 0; }) == 10 &&
+              std::distance(list.begin(), list.end()) == 100);
+
+        Iterator it = list.begin();
+        Iterator old = it++;
+        check("post-increment returns the old position", *old == 1 && *it == 2);
+        *it = -2;
+        ConstIterator converted = it;
+        check("writes through an iterator, reads through the converted const_iterator", *converted == -2 && list.search(-2) == it.node());
+        list.insert_after(3, it.node());
+        check("node() works as an insert_after() position", *std::next(list.begin(), 2) == 3 && list.size() == 101);
+        list.remove_after(it.node());
+        *it = 2;
+
+        // Prefetching changes nothing about what's visited, whatever the distance, including
+        // distances longer than the list (the node ahead runs off the end first)
+        bool same = true;
+        for(size_t distance : {0, 1, 2, 8, 99, 100, 101, 1000})
+        {
+            std::vector<int> visited;
+            for(int element : list.prefetched(distance))
+                visited.push_back(element);
+            std::vector<int> plain(list.begin(), list.end());
+            same = same && visited == plain;
+        }
+        check("prefetched(d) visits the same elements for every d", same);
+
+        // BENCHMARK: a cold walk. sort() relinks the nodes by their random values, so walking
+        // the list jumps around memory instead of going along it, and 4M nodes (64MB) don't
+        // fit in any cache. Each step waits for a load that the prefetch may have started.
+        const int COUNT = 4000000;
+        const int WALKS = 3;
+        SLL<uint64_t> scattered;
+        std::mt19937_64 random(24);
+        for(int i = 0; i < COUNT; i++)
+            scattered.push_front(random());
+        scattered.sort();
+
+        // The node ahead is found by following the same links, so it waits on the same misses
+        // as the walk itself. Prefetching can only win when each element comes with enough work
+        // to hide a miss behind, so the walk is timed with no work and with some hashing.
+        volatile uint64_t sink = 0;
+        auto walk = [&](size_t distance, int rounds)
+        {
+            return timeIt([&]()
+            {
+                for(int pass = 0; pass < WALKS; pass++)
+                {
+                    uint64_t sum = 0;
+                    for(uint64_t element : scattered.prefetched(distance))
+                    {
+                        for(int round = 0; round < rounds; round++)
+                            element = (element ^ (element >> 31)) * 0x9E3779B97F4A7C15ULL;
+                        sum += element;
+                    }
+                    sink = sum;
+                }
+            }) / WALKS;
+        };
+        std::cout << "\nCOLD LIST WALK (" << COUNT << " nodes in random memory order)\n";
+        std::cout << "PREFETCH DISTANCE\tSUM ONLY\tSPEEDUP\t\tHASH EACH\tSPEEDUP\n";
+        double plain = walk(0, 0);
+        double plainHashed = walk(0, 40);
+        std::cout << "none\t\t\t" << plain * 1000 << "ms\t\t\t" << plainHashed * 1000 << "ms\n";
+        for(size_t distance : {1, 4, 8, 16, 32})
+        {
+            double time = walk(distance, 0);
+            double hashed = walk(distance, 40);
+            std::cout << distance << "\t\t\t" << time * 1000 << "ms\t" << plain / time << "x\t"
+                      << hashed * 1000 << "ms\t" << plainHashed / hashed << "x\n";
+        }
+    }
+    #endif // ITERATOR_TEST
+
+    // SLL Relinking Test Section
+    #ifdef RELINK_TEST
+    {
+        std::cout << "\nSLL SPLICE/MERGE/SORT/UNIQUE\n";
+        std::mt19937 random(21);
+        auto fill = [&](SLL<Keyed>& list, std::vector<Keyed>& reference, size_t count, int keys, int firstTag)
+        {
+            reference.clear();
+            for(size_t i = 0; i < count; i++)
+                reference.push_back(Keyed{int(random() % keys), firstTag + int(i)});
+            list.clear();
+            for(auto element = reference.rbegin(); element != reference.rend(); ++element)
+                list.push_front(*element);
+        };
+
+        // sort() against std::stable_sort, few distinct keys so there are lots of ties
+        bool sorts = true;
+        SLL<Keyed> list;
+        std::vector<Keyed> reference;
+        for(size_t size : {0, 1, 2, 3, 7, 64, 100, 1000, 4099})
+        {
+            fill(list, reference, size, 10, 0);
+            list.sort();
+            std::stable_sort(reference.begin(), reference.end());
+            sorts = sorts && sameOrder(list, reference) && list.size() == size && (size == 0 || list.back().tag == reference.back().tag);
+        }
+        check("sort() is stable and keeps back() right", sorts);
+
+        // merge(): equal keys from this list stay in front of the ones from the other
+        bool merges = true;
+        for(size_t size : {0, 1, 5, 300})
+        {
+            SLL<Keyed> other;
+            std::vector<Keyed> otherReference;
+            fill(list, reference, size, 20, 0);
+            fill(other, otherReference, size * 2 + 1, 20, 10000);
+            list.sort();
+            other.sort();
+            std::stable_sort(reference.begin(), reference.end());
+            std::stable_sort(otherReference.begin(), otherReference.end());
+
+            std::vector<Keyed> merged;
+            std::merge(reference.begin(), reference.end(), otherReference.begin(), otherReference.end(), std::back_inserter(merged));
+            list.merge(other);
+            merges = merges && sameOrder(list, merged) && other.size() == 0 && other.begin() == other.end() &&
+                     list.back().tag == merged.back().tag;
+            // Both lists still work afterwards
+            other.push_front(Keyed{-1, -1});
+            list.insert_after(Keyed{99, 99}, int(list.size()) - 1);
+            merges = merges && other.size() == 1 && list.back().key == 99;
+        }
+        check("merge() is stable, empties the other list, keeps back() right", merges);
+
+        // unique() against std::unique
+        bool uniques = true;
+        for(size_t size : {0, 1, 2, 50, 1000})
+        {
+            fill(list, reference, size, 3, 0);
+            size_t removed = list.unique();
+            size_t kept = std::unique(reference.begin(), reference.end()) - reference.begin();
+            reference.resize(kept);
+            uniques = uniques && removed == size - kept && sameOrder(list, reference) && list.size() == kept &&
+                      (kept == 0 || list.back().tag == reference.back().tag);
+        }
+        check("unique() matches std::unique", uniques);
+
+        // splice_after() against std::forward_list::splice_after, same positions in both
+        bool splices = true;
+        for(int round = 0; round < 200; round++)
+        {
+            SLL<Keyed> from;
+            std::vector<Keyed> fromVector;
+            fill(list, reference, random() % 20, 100, 0);
+            fill(from, fromVector, random() % 20, 100, 1000);
+            std::forward_list<Keyed> into(reference.begin(), reference.end());
+            std::forward_list<Keyed> source(fromVector.begin(), fromVector.end());
+
+            // Where to put them: after the element at index "at" (or at the front)
+            size_t at = random() % (reference.size() + 1);
+            Node<Keyed>* position = list.before_begin();
+            auto intoPosition = into.before_begin();
+            for(size_t i = 0; i < at; i++, ++intoPosition)
+                position = position->next;
+
+            if(random() % 2)
+            {
+                list.splice_after(position, from);
+                into.splice_after(intoPosition, source);
+            }
+            else
+            {
+                // The run strictly between first and last, last may be the end
+                size_t first = random() % (fromVector.size() + 1);
+                size_t last = first + 1 + random() % (fromVector.size() - first + 1);
+                Node<Keyed>* firstNode = from.before_begin();
+                Node<Keyed>* lastNode = nullptr;
+                auto sourceFirst = source.before_begin();
+                auto sourceLast = source.end();
+                for(size_t i = 0; i < first; i++, ++sourceFirst)
+                    firstNode = firstNode->next;
+                if(last <= fromVector.size())
+                {
+                    lastNode = firstNode;
+                    sourceLast = sourceFirst;
+                    for(size_t i = first; i < last; i++, ++sourceLast)
+                        lastNode = lastNode->next;
+                }
+                list.splice_after(position, from, firstNode, lastNode);
+                into.splice_after(intoPosition, source, sourceFirst, sourceLast);
+            }
+
+            std::vector<Keyed> expected(into.begin(), into.end());
+            std::vector<Keyed> expectedFrom(source.begin(), source.end());
+            splices = splices && sameOrder(list, expected) && sameOrder(from, expectedFrom) &&
+                      list.size() == expected.size() && from.size() == expectedFrom.size() &&
+                      (expected.empty() || list.back().tag == expected.back().tag) &&
+                      (expectedFrom.empty() || from.back().tag == expectedFrom.back().tag);
+        }
+        check("splice_after() matches std::forward_list and keeps size() and back() right", splices);
+
+        // A run moved inside one list
+        fill(list, reference, 6, 1000, 0);
+        Node<Keyed>* third = list.before_begin()->next->next->next;
+        list.splice_after(list.before_begin(), list, third, nullptr); // the last three to the front
+        std::rotate(reference.begin(), reference.begin() + 3, reference.end());
+        check("splice_after() within the same list", sameOrder(list, reference) && list.size() == 6 &&
+              list.back().tag == reference.back().tag);
+
+        ArenaResource arena;
+        SLL<Keyed> elsewhere(&arena);
+        elsewhere.push_front(Keyed{0, 0});
+        bool threw = false;
+        try { list.merge(elsewhere); } catch(const std::invalid_argument&) { threw = true; }
+        check("merge() refuses a list from another memory resource", threw && elsewhere.size() == 1 && list.size() == 6);
+
+        // BENCHMARK: sorting 10^6 random ints, relinking only
+        const int COUNT = 1000000;
+        SLL<int> numbers;
+        std::forward_list<int> forward;
+        for(int i = 0; i < COUNT; i++)
+        {
+            int value = int(random());
+            numbers.push_front(value);
+            forward.push_front(value);
+        }
+        double sllSort = timeIt([&]() { numbers.sort(); });
+        double forwardSort = timeIt([&]() { forward.sort(); });
+        check("sorted the same", std::equal(numbers.begin(), numbers.end(), forward.begin(), forward.end()));
+        std::cout << "\nSORT " << COUNT << " INTS\nSLL::sort\t\t\t" << sllSort * 1000 << "ms\n"
+                  << "std::forward_list::sort\t\t" << forwardSort * 1000 << "ms\n";
+    }
+    #endif // RELINK_TEST
+
+    // Unrolled SLL Test Section
+    #ifdef UNROLLED_TEST
+    {
+        std::cout << "\nUNROLLED SLL AGAINST std::list\n";
+        checkChunkSizes(std::make_index_sequence<12>());
+
+        // remove_after(int) counts from the first element: remove_after(0) removes the second
+        std::cout << "\nSLL remove_after(int)\n";
+        SLL<int> list;
+        for(int i = 9; i >= 0; i--)
+            list.push_front(i);
+        list.remove_after(0);
+        check("remove_after(0) removes the second element", list.size() == 9 && list.front() == 0 && list.search(1) == nullptr);
+        list.remove_after(int(list.size()) - 2);
+        check("remove_after(size() - 2) removes the last element", list.size() == 8 && list.back() == 8);
+        list.push_front(-1);
+        list.insert_after(100, int(list.size()) - 1);
+        check("back() is right after removing the last element", list.back() == 100);
+
+        bool threw = false;
+        try { list.remove_after(int(list.size()) - 1); } catch(const std::out_of_range&) { threw = true; }
+        check("remove_after(size() - 1) throws, nothing follows the last element", threw && list.size() == 10);
+        threw = false;
+        try { list.remove_after(-1); } catch(const std::out_of_range&) { threw = true; }
+        check("remove_after(-1) throws", threw);
+
+        UnrolledSLL<int, 4> unrolled;
+        for(int i = 9; i >= 0; i--)
+            unrolled.push_front(i);
+        unrolled.remove_after(0);
+        check("UnrolledSLL::remove_after(0) removes the second element too", contents(unrolled) == std::vector<int>({0, 2, 3, 4, 5, 6, 7, 8, 9}));
+    }
+    #endif // UNROLLED_TEST
+
+    // SLL Node Layout Test Section
+    #ifdef LAYOUT_TEST
+    {
+        // BENCHMARK: SLL's raw links against the layout it had before, where every next was a
+        // std::shared_ptr. Walking that one copies a shared_ptr per step (two atomic counter
+        // updates), and every node carries a control block.
+        struct SharedNode
+        {
+            int data;
+            std::shared_ptr<SharedNode> next;
+        };
+        const int COUNT = 1000000;
+        const int WALKS = 10;
+        const int INSERTS = 100;
+        volatile long sink = 0;
+
+        std::shared_ptr<SharedNode> sharedHead;
+        double sharedBuild = timeIt([&]()
+        {
+            for(int i = COUNT - 1; i >= 0; i--)
+                sharedHead = std::make_shared<SharedNode>(SharedNode{i, sharedHead});
+        });
+        double sharedWalk = timeIt([&]()
+        {
+            for(int walk = 0; walk < WALKS; walk++)
+            {
+                // The old search(): a shared_ptr copy per step, looking for a missing element
+                std::shared_ptr<SharedNode> position = sharedHead;
+                while(position && position->data != -1)
+                    position = position->next;
+                sink = sink + (position != nullptr);
+            }
+        });
+        double sharedInsert = timeIt([&]()
+        {
+            for(int insert = 0; insert < INSERTS; insert++)
+            {
+                // The old insert_after(DATA, int): walk to the index, then link in
+                std::shared_ptr<SharedNode> position = sharedHead;
+                for(int step = 0; step < COUNT / 2; step++)
+                    position = position->next;
+                position->next = std::make_shared<SharedNode>(SharedNode{insert, position->next});
+            }
+        });
+        // Unlinked one node at a time, letting go of the head would recurse down the chain
+        while(sharedHead)
+            sharedHead = std::move(sharedHead->next);
+
+        SLL<int> rawList;
+        double rawBuild = timeIt([&]()
+        {
+            for(int i = COUNT - 1; i >= 0; i--)
+                rawList.push_front(i);
+        });
+        double rawWalk = timeIt([&]()
+        {
+            for(int walk = 0; walk < WALKS; walk++)
+                sink = sink + (rawList.search(-1) != nullptr);
+        });
+        double rawInsert = timeIt([&]()
+        {
+            for(int insert = 0; insert < INSERTS; insert++)
+                rawList.insert_after(insert, COUNT / 2);
+        });
+        check("the raw list got every element", rawList.size() == size_t(COUNT + INSERTS));
+
+        std::cout << "\nSLL NODE LAYOUT (" << COUNT << " ints)\n";
+        std::cout << "LAYOUT\t\tNODE BYTES\tBUILD\t\t" << WALKS << " WALKS\t" << INSERTS << " MID INSERTS\n";
+        std::cout << "shared_ptr\t" << sizeof(SharedNode) << " + ctrl\t" << sharedBuild * 1000 << "ms\t"
+                  << sharedWalk * 1000 << "ms\t" << sharedInsert * 1000 << "ms\n";
+        std::cout << "raw pointer\t" << sizeof(Node<int>) << "\t\t" << rawBuild * 1000 << "ms\t"
+                  << rawWalk * 1000 << "ms\t" << rawInsert * 1000 << "ms\n";
+        std::cout << "(make_shared puts a 16 byte control block in front of every shared_ptr node)\n";
+    }
+    #endif // LAYOUT_TEST
+
+    // SLL Teardown Test Section
+    #ifdef TEARDOWN_TEST
+    {
+        // BENCHMARK: how long it takes to get rid of a list. pop_front() hands the nodes back
+        // one at a time; clear() and the destructor unlink in a loop and give the whole chain
+        // back to the node pool in one step. std::forward_list::clear() (one free per node) is only run
+        // up to 10^7, at 10^8 it and the pool's slabs wouldn't both fit in memory here.
+        auto build = [](SLL<int>& list, size_t count)
+        {
+            for(size_t i = 0; i < count; i++)
+                list.push_front(int(i));
+        };
+
+        std::cout << "\nSLL TEARDOWN\n";
+        std::cout << "NODES\t\tpop_front LOOP\tclear()\t\t~SLL()\t\tstd::forward_list\n";
+        bool emptied = true;
+        for(size_t count : {size_t(100000), size_t(1000000), size_t(10000000), size_t(100000000)})
+        {
+            SLL<int> popped;
+            build(popped, count);
+            double popTime = timeIt([&]() { while(popped.size()) popped.pop_front(); });
+
+            SLL<int> cleared;
+            build(cleared, count);
+            double clearTime = timeIt([&]() { cleared.clear(); });
+            emptied = emptied && popped.size() == 0 && cleared.size() == 0 && cleared.begin() == cleared.end();
+
+            auto destroyed = std::make_unique<SLL<int>>();
+            build(*destroyed, count);
+            double destroyTime = timeIt([&]() { destroyed.reset(); });
+
+            std::cout << count << (count < 10000000 ? "\t\t" : "\t") << popTime * 1000 << "ms\t" << clearTime * 1000 << "ms\t"
+                      << destroyTime * 1000 << "ms\t";
+            if(count <= 10000000)
+            {
+                std::forward_list<int> reference;
+                for(size_t i = 0; i < count; i++)
+                    reference.push_front(int(i));
+                std::cout << timeIt([&]() { reference.clear(); }) * 1000 << "ms\n";
+            }
+            else
+                std::cout << "-\n";
+        }
+        check("every list was emptied", emptied);
+    }
+    #endif // TEARDOWN_TEST
+
+    // Indexed SLL Test Section
+    #ifdef INDEX_TEST
+    {
+        std::cout << "\nSLL INDEX\n";
+        // The index is right if every element in the list is found at its own node, and
+        // nothing that left the list is found at all
+        auto consistent = [](SLL<int>& list, const std::vector<int>& gone)
+        {
+            size_t count = 0;
+            for(int& element : list)
+            {
+                Node<int>* found = list.search(element);
+                if(!found || &found->data != &element)
+                    return false;
+                count++;
+            }
+            for(int element : gone)
+                if(list.search(element))
+                    return false;
+            return count == list.size();
+        };
+
+        SLL<int> list;
+        for(int i = 19; i >= 0; i--)
+            list.push_front(i * 7 % 20); // 0..19 shuffled
+        list.enableIndex();
+        check("enableIndex() files every node", list.indexed() && list.indexBytes() > 0 && consistent(list, {}));
+
+        std::vector<int> gone;
+        gone.push_back(list.front());
+        list.pop_front();
+        check("pop_front()", consistent(list, gone));
+
+        Node<int>* position = list.search(5);
+        gone.push_back(position->next->data);
+        list.remove_after(position);
+        gone.push_back(*std::next(list.begin()));
+        list.remove_after(0);
+        check("remove_after()", consistent(list, gone));
+
+        list.sort();
+        check("sort()", std::is_sorted(list.begin(), list.end()) && consistent(list, gone));
+
+        // Elements that left before come back through the splices
+        int back = gone[0];
+        gone.erase(gone.begin());
+        SLL<int> other;
+        other.push_front(back);
+        other.enableIndex();
+        list.splice_after(list.before_begin(), other);
+        check("splice_after() of a whole list", other.size() == 0 && consistent(list, gone) && consistent(other, {back}));
+
+        // part is [stays, back], only back moves over
+        int stays = gone[0];
+        back = gone[1];
+        gone.erase(gone.begin() + 1);
+        SLL<int> part;
+        part.push_front(back);
+        part.push_front(stays);
+        part.enableIndex();
+        list.splice_after(list.search(list.front()), part, part.search(stays), nullptr); // everything after stays
+        check("splice_after() of a run", consistent(list, gone) && part.size() == 1 && consistent(part, {back}));
+
+        list.sort();
+        SLL<int> sorted;
+        for(int i = 5; i >= 1; i--)
+            sorted.push_front(100 + i);
+        list.merge(sorted);
+        check("merge() of an unindexed list", std::is_sorted(list.begin(), list.end()) && consistent(list, gone));
+
+        list.push_front(list.front());
+        list.push_front(list.front());
+        size_t removed = list.unique();
+        check("unique()", removed == 2 && consistent(list, gone));
+
+        list.clear();
+        std::vector<int> everything(200);
+        std::iota(everything.begin(), everything.end(), -50);
+        check("clear()", list.size() == 0 && consistent(list, everything));
+        list.push_front(42);
+        check("inserting after clear()", consistent(list, {41, 43}));
+
+        list.disableIndex();
+        check("disableIndex()", !list.indexed() && list.indexBytes() == 0 && consistent(list, {41, 43}));
+
+        // BENCHMARK: look up random elements of a 10^6 element list with and without the index
+        const int COUNT = 1000000;
+        const int WALKS = 100;
+        const int LOOKUPS = 100000;
+        SLL<int> big;
+        for(int i = COUNT - 1; i >= 0; i--)
+            big.push_front(i);
+        std::mt19937 random(22);
+        std::uniform_int_distribution<int> element(0, COUNT - 1);
+        volatile long sink = 0;
+
+        double walked = timeIt([&]() { for(int i = 0; i < WALKS; i++) sink = sink + big.search(element(random))->data; });
+        double building = timeIt([&]() { big.enableIndex(); });
+        double hashed = timeIt([&]() { for(int i = 0; i < LOOKUPS; i++) sink = sink + big.search(element(random))->data; });
+
+        std::cout << "\nSLL SEARCH (" << COUNT << " elements)\n";
+        std::cout << "WITHOUT INDEX\t" << walked / WALKS * 1e6 << "us per search\n";
+        std::cout << "WITH INDEX\t" << hashed / LOOKUPS * 1e6 << "us per search\n";
+        std::cout << "SPEEDUP\t\t" << (walked / WALKS) / (hashed / LOOKUPS) << "x\n";
+        std::cout << "INDEX BUILD\t" << building * 1000 << "ms\n";
+        std::cout << "INDEX MEMORY\t" << big.indexBytes() << " bytes (" << double(big.indexBytes()) / COUNT
+                  << " per element, each node is " << sizeof(Node<int>) << ")\n";
+    }
+    #endif // INDEX_TEST
+
+    // Concurrent SLL Test Section
+    #ifdef CONCURRENT_SLL_TEST
+    {
+        // STRESS TEST: 8 threads insert, remove and search at the same time. Thread t only
+        // inserts and removes the keys k with k % 8 == t, so it knows which of its keys are in
+        // the list at the end, but the keys are interleaved so the threads all fight over the
+        // same nodes. Every thread also searches the other threads' keys.
+        const int THREADS = 8;
+        const int KEYS = 512;
+        const int OPS = 20000;
+
+        ConcurrentSLL<int> concurrentList;
+        std::vector<std::vector<char>> present(THREADS, std::vector<char>(KEYS, 0));
+        std::vector<long> net(THREADS, 0);
+
+        std::vector<std::thread> workers;
+        for(int t = 0; t < THREADS; t++)
+        {
+            workers.emplace_back([&, t]()
+            {
+                std::mt19937 random(t + 1);
+                for(int op = 0; op < OPS; op++)
+                {
+                    int key = int(random() % (KEYS / THREADS)) * THREADS + t;
+                    switch(random() % 3)
+                    {
+                        case 0:
+                            if(concurrentList.insert(key))
+                            {
+                                present[t][key] = 1;
+                                net[t]++;
+                            }
+                            break;
+                        case 1:
+                            if(concurrentList.remove(key))
+                            {
+                                present[t][key] = 0;
+                                net[t]--;
+                            }
+                            break;
+                        default:
+                            concurrentList.search(int(random() % KEYS));
+                            break;
+                    }
+                }
+            });
+        }
+        for(std::thread& worker : workers)
+            worker.join();
+
+        long expectedSize = 0;
+        int wrong = 0;
+        for(int t = 0; t < THREADS; t++)
+        {
+            expectedSize += net[t];
+            for(int key = t; key < KEYS; key += THREADS)
+                if(concurrentList.search(key) != bool(present[t][key]))
+                    wrong++;
+        }
+
+        std::cout << "\nCONCURRENT SLL STRESS TEST (" << THREADS << " threads, " << OPS << " ops each)\n";
+        std::cout << "EXPECTED SIZE: " << expectedSize << " RECIEVED: " << concurrentList.size() << "\n";
+        std::cout << "KEYS IN THE WRONG STATE: " << wrong << "\n";
+        std::cout << ((wrong == 0 && concurrentList.size() == size_t(expectedSize)) ? "PASSED\n" : "FAILED\n");
+
+        // BENCHMARK: throughput as threads are added, 20% inserts, 20% removes, 60% searches
+        // over 1024 keys, starting half full
+        std::cout << "\nCONCURRENT SLL THROUGHPUT\n";
+        for(int threadCount = 1; threadCount <= THREADS; threadCount *= 2)
+        {
+            ConcurrentSLL<int> benchList;
+            for(int key = 0; key < 1024; key += 2)
+                benchList.insert(key);
+
+            std::vector<std::thread> benchWorkers;
+            auto start = std::chrono::steady_clock::now();
+            for(int t = 0; t < threadCount; t++)
+            {
+                benchWorkers.emplace_back([&benchList, t]()
+                {
+                    std::mt19937 random(t + 100);
+                    for(int op = 0; op < 100000; op++)
+                    {
+                        int key = int(random() % 1024);
+                        unsigned roll = random() % 10;
+                        if(roll < 2)
+                            benchList.insert(key);
+                        else if(roll < 4)
+                            benchList.remove(key);
+                        else
+                            benchList.search(key);
+                    }
+                });
+            }
+            for(std::thread& worker : benchWorkers)
+                worker.join();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << threadCount << " THREAD(S): " << long(threadCount * 100000 / seconds) << " ops/s\n";
+        }
+    }
+    #endif // CONCURRENT_SLL_TEST
+
+    // Stack and Queue Test Section
+    #ifdef STACK_LIST_TEST
+    {
+        std::cout << "\nSTACK/QUEUE COPY/MOVE COUNTS\n";
+        Stack<Counted> listStack;
+        VectorBased::Stack<Counted> vectorStack;
+        Queue<Counted> queue;
+        Counted::reset();
+
+        listStack.emplace(1, 2);
+        Counted::check("Stack (list) emplace(1, 2)", 1, 0, 0);
+        listStack.push(Counted(3, 4));
+        Counted::check("Stack (list) push(Counted&&)", 1, 0, 1);
+
+        vectorStack.emplace(1, 2);
+        Counted::check("Stack (vector) emplace(1, 2)", 1, 0, 0);
+        vectorStack.push(Counted(3, 4));
+        Counted::check("Stack (vector) push(Counted&&)", 1, 0, 1);
+
+        queue.emplace(1, 2);
+        Counted::check("Queue emplace(1, 2)", 1, 0, 0);
+        queue.emplace(3, 4);
+        Counted::check("Queue emplace(3, 4) (not empty)", 1, 0, 0);
+        queue.enqueue(Counted(5, 6));
+        Counted::check("Queue enqueue(Counted&&)", 1, 0, 1);
+    }
+    #endif // STACK_LIST_TEST
+
+    // Parallel Algorithms Test Section
+    #ifdef PARALLEL_TEST
+    {
+        // Sorts records by key only, so the order field shows whether equal keys kept their order
+        struct Record
+        {
+            int key;
+            int order;
+            bool operator==(const Record& other) const { return key == other.key && order == other.order; }
+        };
+        auto byKey = [](const Record& lhs, const Record& rhs) { return lhs.key < rhs.key; };
+
+        const size_t COUNT = 2000000;
+        std::mt19937 random(9);
+        std::vector<Record> records(COUNT);
+        std::vector<long long> numbers(COUNT);
+        for(size_t i = 0; i < COUNT; i++)
+        {
+            records[i] = Record{int(random() % 1000), int(i)};
+            numbers[i] = random() % 1000;
+        }
+
+        std::vector<Record> sortedRecords = records;
+        std::stable_sort(sortedRecords.begin(), sortedRecords.end(), byKey);
+        long long expectedSum = std::accumulate(numbers.begin(), numbers.end(), 0LL);
+        long long expectedSquares = 0;
+        for(long long number : numbers)
+            expectedSquares += number * number;
+
+        // Runs all four algorithms on a pool and checks them against the standard library
+        auto runAll = [&](ThreadPool& pool, size_t grain, double seconds[4])
+        {
+            bool passed = true;
+
+            Vector<Record> toSort(static_cast<int>(COUNT));
+            toSort.append(records);
+            seconds[0] = timeIt([&]() { parallelSort(pool, toSort, byKey, grain); });
+            passed = passed && std::equal(toSort.begin(), toSort.end(), sortedRecords.begin(), sortedRecords.end());
+
+            Vector<long long> values(static_cast<int>(COUNT));
+            values.append(numbers);
+            seconds[1] = timeIt([&]() { parallelForEach(pool, values, [](long long& value) { value *= value; }, grain); });
+            passed = passed && std::accumulate(values.begin(), values.end(), 0LL) == expectedSquares;
+
+            Vector<long long> original(static_cast<int>(COUNT));
+            original.append(numbers);
+            Vector<long long> doubled(static_cast<int>(COUNT));
+            doubled.append(numbers);
+            seconds[2] = timeIt([&]() { parallelTransform(pool, original, doubled, [](long long value) { return 2 * value; }, grain); });
+            passed = passed && std::accumulate(doubled.begin(), doubled.end(), 0LL) == 2 * expectedSum;
+
+            long long sum = 0;
+            seconds[3] = timeIt([&]() { sum = parallelReduce(pool, original, 0LL, std::plus<long long>(), grain); });
+            passed = passed && sum == expectedSum;
+
+            return passed;
+        };
+
+        // CORRECTNESS: 4 threads and a small grain, so splitting and stealing happen even on a
+        // machine with fewer cores
+        {
+            ThreadPool pool(4);
+            double seconds[4];
+            check("\nPARALLEL SORT/FOR_EACH/TRANSFORM/REDUCE (4 threads, grain 1000) MATCH THE STANDARD LIBRARY",
+                  runAll(pool, 1000, seconds));
+        }
+
+        // BENCHMARK: scaling from 1 thread to every hardware thread
+        size_t hardwareThreads = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+        std::cout << "\nPARALLEL ALGORITHMS SCALING (" << COUNT << " elements, seconds)\n";
+        std::cout << "THREADS   SORT      FOR_EACH  TRANSFORM REDUCE\n";
+        for(size_t threadCount = 1; ; threadCount = std::min(threadCount * 2, hardwareThreads))
+        {
+            ThreadPool pool(threadCount);
+            double seconds[4];
+            bool passed = runAll(pool, DEFAULT_GRAIN, seconds);
+
+            std::cout << threadCount << "\t  ";
+            for(double time : seconds)
+                std::cout << std::to_string(time).substr(0, 8) << "  ";
+            std::cout << (passed ? "PASSED" : "FAILED") << "\n";
+
+            if(threadCount == hardwareThreads)
+                break;
+        }
+    }
+    #endif // PARALLEL_TEST
+
+    // Growth Policy Test Section
+    #ifdef GROWTH_TEST
+    {
+        std::cout << "\nINCREMENTAL VECTOR MIGRATION\n";
+
+        // Pushes until the vector is halfway through moving its old buffer
+        auto fillUntilMigrating = [](IncrementalVector<Tracked>& vector, long& next)
+        {
+            while(!vector.isMigrating() || vector.size() < 100)
+                vector.push_back(Tracked(next++));
+        };
+        auto holds = [](IncrementalVector<Tracked>& vector, long count)
+        {
+            if(long(vector.size()) != count)
+                return false;
+            for(long i = 0; i < count; i++)
+                if(vector[i].value != i)
+                    return false;
+            return true;
+        };
+
+        {
+            // POP_BACK: popping everything walks back from the new buffer into the old one
+            IncrementalVector<Tracked> vector;
+            long next = 0;
+            fillUntilMigrating(vector, next);
+            bool passed = true;
+            while(!vector.empty())
+            {
+                passed = passed && vector.back().value == next - 1 && holds(vector, next);
+                vector.pop_back();
+                next--;
+            }
+            check("pop_back into the old buffer", passed && Tracked::alive == 0);
+
+            // and the vector still works afterwards
+            for(next = 0; next < 1000; next++)
+                vector.push_back(Tracked(next));
+            check("push_back after popping everything", holds(vector, 1000));
+        }
+        check("no elements leaked", Tracked::alive == 0);
+
+        {
+            // CLEAR: destroys what is in both buffers and leaves a working, empty vector
+            IncrementalVector<Tracked> vector;
+            long next = 0;
+            fillUntilMigrating(vector, next);
+            vector.clear();
+            check("clear while migrating", vector.empty() && !vector.isMigrating() && Tracked::alive == 0);
+
+            for(next = 0; next < 1000; next++)
+                vector.push_back(Tracked(next));
+            check("push_back after clear", holds(vector, 1000));
+        }
+        check("no elements leaked", Tracked::alive == 0);
+
+        {
+            // COPY: a copy taken halfway through holds the same elements, and both go on on their own
+            IncrementalVector<Tracked> vector;
+            long next = 0;
+            fillUntilMigrating(vector, next);
+            long count = next;
+
+            IncrementalVector<Tracked> copy(vector);
+            IncrementalVector<Tracked> assigned;
+            assigned = vector;
+            check("copy while migrating", holds(copy, count) && holds(assigned, count) && holds(vector, count));
+
+            for(; next < count + 500; next++)
+            {
+                vector.push_back(Tracked(next));
+                copy.push_back(Tracked(next));
+            }
+            copy.pop_back();
+            check("copies are independent", holds(vector, count + 500) && holds(copy, count + 499) && holds(assigned, count));
+        }
+        check("no elements leaked", Tracked::alive == 0);
+
+        // BENCHMARK: how long each single push_back takes, for 4M pushes of a 32 byte element.
+        // Doubling and 1.5x growth copy everything at once every so often, which shows up at
+        // the 99.9th percentile and in the max. IncrementalVector spreads that out.
+        struct Payload
+        {
+            long long fields[4];
+        };
+        const size_t PUSHES = 4000000;
+        std::vector<uint32_t> nanoseconds(PUSHES);
+
+        auto measure = [&](const char* name, auto& vector)
+        {
+            for(size_t i = 0; i < PUSHES; i++)
+            {
+                auto start = std::chrono::steady_clock::now();
+                vector.push_back(Payload{{(long long)i, 0, 0, 0}});
+                auto end = std::chrono::steady_clock::now();
+                nanoseconds[i] = uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            }
+
+            std::sort(nanoseconds.begin(), nanoseconds.end());
+            auto percentile = [&](double fraction) { return nanoseconds[size_t(fraction * (PUSHES - 1))]; };
+            std::cout << name << "\tp50 " << percentile(0.5) << "ns\tp99 " << percentile(0.99) << "ns\tp999 "
+                      << percentile(0.999) << "ns\tmax " << nanoseconds.back() << "ns\n";
+        };
+
+        std::cout << "\nPUSH_BACK LATENCY (" << PUSHES << " pushes of 32 bytes)\n";
+        {
+            Vector<Payload, DoublingGrowth> vector;
+            measure("Vector 2x     ", vector);
+        }
+        {
+            Vector<Payload, OneAndHalfGrowth> vector;
+            measure("Vector 1.5x   ", vector);
+        }
+        {
+            IncrementalVector<Payload> vector;
+            measure("Incremental   ", vector);
+        }
+    }
+    #endif // GROWTH_TEST
+
+    // SIMD Kernels Test Section
+    #ifdef SIMD_TEST
+    {
+        // CORRECTNESS: every function against ScalarKernels, for every element type with
+        // kernels, at sizes around the register widths (4 or 8 lanes for AVX2, 2 or 4 for SSE2)
+        // so the leftover elements at the end take the scalar tail loop. Values are small whole
+        // numbers, so float and double sums are exact whatever order they're added in.
+        std::cout << "\nSIMD KERNELS AGAINST THE SCALAR LOOP (SIMD level "
+                  << (simdLevel() == SimdLevel::AVX2 ? "AVX2" : simdLevel() == SimdLevel::SSE2 ? "SSE2" : "SCALAR") << ")\n";
+        const size_t SIZES[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 1000, 1001, 1003};
+
+        auto testType = [&](const char* name, auto tag)
+        {
+            using T = decltype(tag);
+            std::mt19937 random(8);
+            bool passed = true;
+
+            Vector<T> vector;
+            for(size_t size : SIZES)
+            {
+                vector.clear();
+                for(size_t i = 0; i < size; i++)
+                    vector.push_back(T(int(random() % 200) - 100));
+                const T* data = vector.data();
+
+                // a value that's there (the last element, which is in the tail), and one that isn't
+                T needles[] = {size ? data[size - 1] : T(0), T(1000)};
+                for(T needle : needles)
+                {
+                    passed = passed && find(vector, needle) == ScalarKernels::find(data, size, needle);
+                    passed = passed && count(vector, needle) == ScalarKernels::count(data, size, needle);
+                    passed = passed && contains(vector, needle) == (ScalarKernels::find(data, size, needle) != size);
+                    #ifdef VECTOR_SIMD_X86
+                    using S = SimdElement<T>;
+                    passed = passed && Sse2Kernels<S>::find(data, size, needle) == ScalarKernels::find(data, size, needle);
+                    passed = passed && Sse2Kernels<S>::count(data, size, needle) == ScalarKernels::count(data, size, needle);
+                    if(simdLevel() == SimdLevel::AVX2)
+                    {
+                        passed = passed && Avx2Kernels<S>::find(data, size, needle) == ScalarKernels::find(data, size, needle);
+                        passed = passed && Avx2Kernels<S>::count(data, size, needle) == ScalarKernels::count(data, size, needle);
+                    }
+                    #endif
+                }
+
+                passed = passed && sum(vector) == ScalarKernels::sum(data, size);
+                #ifdef VECTOR_SIMD_X86
+                using S = SimdElement<T>;
+                passed = passed && Sse2Kernels<S>::sum(data, size) == ScalarKernels::sum(data, size);
+                if(simdLevel() == SimdLevel::AVX2)
+                    passed = passed && Avx2Kernels<S>::sum(data, size) == ScalarKernels::sum(data, size);
+                #endif
+
+                if(size == 0)
+                {
+                    bool threw = false;
+                    try { minValue(vector); } catch(const std::out_of_range&) { threw = true; }
+                    passed = passed && threw;
+                    continue;
+                }
+                passed = passed && minValue(vector) == ScalarKernels::extreme<false>(data, size);
+                passed = passed && maxValue(vector) == ScalarKernels::extreme<true>(data, size);
+                #ifdef VECTOR_SIMD_X86
+                // The vector kernels need at least one full register
+                if(Sse2Ops<S>::MINMAX && size >= Sse2Ops<S>::LANES)
+                {
+                    passed = passed && Sse2Kernels<S>::template extreme<false>(data, size) == ScalarKernels::extreme<false>(data, size);
+                    passed = passed && Sse2Kernels<S>::template extreme<true>(data, size) == ScalarKernels::extreme<true>(data, size);
+                }
+                if(simdLevel() == SimdLevel::AVX2 && size >= Avx2Ops<S>::LANES)
+                {
+                    passed = passed && Avx2Kernels<S>::template extreme<false>(data, size) == ScalarKernels::extreme<false>(data, size);
+                    passed = passed && Avx2Kernels<S>::template extreme<true>(data, size) == ScalarKernels::extreme<true>(data, size);
+                }
+                #endif
+            }
+            check(std::string(name) + " find/count/contains/minValue/maxValue/sum", passed);
+        };
+        testType("int32_t", int32_t());
+        testType("int64_t", int64_t());
+        testType("float  ", float());
+        testType("double ", double());
+
+        // BENCHMARK: each scan over 4M elements (the value searched for isn't there, so find
+        // reads everything), scalar loop against the SSE2 and AVX2 kernels
+        const size_t COUNT = 4 * 1024 * 1024;
+        std::cout << "\nSIMD KERNELS BENCHMARK (" << COUNT << " elements, milliseconds per scan)\n";
+        std::cout << "TYPE     KERNEL  FIND    COUNT   MIN     MAX     SUM\n";
+
+        auto benchType = [&](const char* name, auto tag)
+        {
+            using T = decltype(tag);
+            std::mt19937 random(8);
+            std::vector<T> values(COUNT);
+            for(T& value : values)
+                value = T(int(random() % 200) - 100);
+            const T* data = values.data();
+            const T needle = T(1000);
+
+            // Runs each scan 5 times and keeps the fastest. sink keeps the results alive.
+            volatile double sink = 0;
+            auto row = [&](const char* kernel, auto findScan, auto countScan, auto minScan, auto maxScan, auto sumScan)
+            {
+                std::cout << name << "  " << kernel << "  ";
+                for(auto scan : {std::function<double()>(findScan), std::function<double()>(countScan),
+                                 std::function<double()>(minScan), std::function<double()>(maxScan),
+                                 std::function<double()>(sumScan)})
+                {
+                    double best = 1e9;
+                    for(int repeat = 0; repeat < 5; repeat++)
+                        best = std::min(best, timeIt([&]() { sink += scan(); }));
+                    std::cout << std::to_string(best * 1000).substr(0, 6) << "  ";
+                }
+                std::cout << "\n";
+            };
+
+            row("scalar",
+                [&]() { return double(ScalarKernels::find(data, COUNT, needle)); },
+                [&]() { return double(ScalarKernels::count(data, COUNT, needle)); },
+                [&]() { return double(ScalarKernels::extreme<false>(data, COUNT)); },
+                [&]() { return double(ScalarKernels::extreme<true>(data, COUNT)); },
+                [&]() { return double(ScalarKernels::sum(data, COUNT)); });
+            #ifdef VECTOR_SIMD_X86
+            using S = SimdElement<T>;
+            // int64_t has no SSE2 min/max, so those columns show the scalar loop it falls back to
+            row("SSE2  ",
+                [&]() { return double(Sse2Kernels<S>::find(data, COUNT, needle)); },
+                [&]() { return double(Sse2Kernels<S>::count(data, COUNT, needle)); },
+                [&]() { return double(Sse2Ops<S>::MINMAX ? Sse2Kernels<S>::template extreme<false>(data, COUNT) : ScalarKernels::extreme<false>(data, COUNT)); },
+                [&]() { return double(Sse2Ops<S>::MINMAX ? Sse2Kernels<S>::template extreme<true>(data, COUNT) : ScalarKernels::extreme<true>(data, COUNT)); },
+                [&]() { return double(Sse2Kernels<S>::sum(data, COUNT)); });
+            if(simdLevel() == SimdLevel::AVX2)
+                row("AVX2  ",
+                    [&]() { return double(Avx2Kernels<S>::find(data, COUNT, needle)); },
+                    [&]() { return double(Avx2Kernels<S>::count(data, COUNT, needle)); },
+                    [&]() { return double(Avx2Kernels<S>::template extreme<false>(data, COUNT)); },
+                    [&]() { return double(Avx2Kernels<S>::template extreme<true>(data, COUNT)); },
+                    [&]() { return double(Avx2Kernels<S>::sum(data, COUNT)); });
+            #endif
+        };
+        benchType("int32_t", int32_t());
+        benchType("int64_t", int64_t());
+        benchType("float  ", float());
+        benchType("double ", double());
+    }
+    #endif // SIMD_TEST
+
+    // Huge Page Test Section
+    #ifdef HUGEPAGE_TEST
+    {
+        // BENCHMARK: random reads over a 512MB Vector. With 4KB pages every read is likely a TLB
+        // miss and a page walk; one 2MB page covers 512 times as much, so far fewer misses.
+        // The plain buffer comes from AlignedResource (page aligned, but nothing asks the kernel
+        // for huge pages), the other from HugePageResource (mmap + madvise).
+        const size_t COUNT = size_t(1) << 26; // 8 byte elements
+        const size_t READS = 20000000;
+        AlignedResource pageAligned(4096);
+        HugePageResource hugePages;
+        size_t reported = 0;
+        auto scan = [&](std::pmr::memory_resource* resource, size_t& backed)
+        {
+            Vector<uint64_t> values(static_cast<int>(COUNT), resource);
+            for(size_t i = 0; i < COUNT; i++)
+                values.push_back(i);
+            backed = hugePageBackedBytes(values.data(), COUNT * sizeof(uint64_t));
+            if(resource == &hugePages)
+                reported = hugePages.hugePageBytes();
+
+            volatile uint64_t sink = 0;
+            return timeIt([&]()
+            {
+                // A linear congruential walk, so the addresses don't come from another array
+                uint64_t index = 1, sum = 0;
+                for(size_t read = 0; read < READS; read++)
+                {
+                    index = (index * 6364136223846793005ULL + 1442695040888963407ULL) & (COUNT - 1);
+                    sum += values[index];
+                }
+                sink = sum;
+            });
+        };
+
+        size_t plainBacked = 0, hugeBacked = 0;
+        double plainTime = scan(&pageAligned, plainBacked);
+        double hugeTime = scan(&hugePages, hugeBacked);
+
+        std::cout << "\nRANDOM ACCESS SCAN (" << (COUNT * sizeof(uint64_t) >> 20) << "MB, " << READS << " reads)\n";
+        std::cout << "RESOURCE\t\tHUGE PAGE BACKED\tTIME\n";
+        std::cout << "AlignedResource\t\t" << (plainBacked >> 20) << "MB\t\t\t" << plainTime * 1000 << "ms\n";
+        std::cout << "HugePageResource\t" << (hugeBacked >> 20) << "MB\t\t\t" << hugeTime * 1000 << "ms\n";
+        std::cout << "SPEEDUP\t\t\t\t\t\t" << plainTime / hugeTime << "x\n";
+        std::cout << "HugePageResource::hugePageBytes() during the scan: " << (reported >> 20) << "MB\n";
+        if(hugeBacked == 0)
+            std::cout << "(NO HUGE PAGES: transparent huge pages are off or none were free, both rows use 4KB pages)\n";
+    }
+    #endif // HUGEPAGE_TEST
+
+    // Trivially Copyable Vector Test Section
+    #ifdef TRIVIAL_TEST
+    {
+        static_assert(std::is_trivially_copyable<int>::value && !std::is_trivially_copyable<Boxed>::value,
+                      "the benchmark needs one type on each path");
+
+        // BENCHMARK: the same 4 byte payload through both paths of Vector. push_back from empty
+        // grows the buffer log(n) times (realloc for int, allocate + move loop + free for Boxed),
+        // append() into a big enough buffer is one memcpy for int and a copy loop for Boxed.
+        // Small sizes are repeated so every row does about the same amount of work.
+        auto benchmark = [](auto element, size_t count, int repeats, double& grow, double& copy, long& total)
+        {
+            using Element = decltype(element);
+            Vector<Element> source;
+            Vector<Element> target;
+            grow = timeIt([&]()
+            {
+                for(int repeat = 0; repeat < repeats; repeat++)
+                {
+                    source.clear();
+                    source.shrink_to_fit();
+                    for(size_t i = 0; i < count; i++)
+                        source.push_back(Element(int(i)));
+                }
+            });
+            // One untimed copy, so the timed ones don't pay for the first touch of the pages
+            target.reserve(count);
+            target.append(source);
+            copy = timeIt([&]()
+            {
+                for(int repeat = 0; repeat < repeats; repeat++)
+                {
+                    target.clear();
+                    target.append(source);
+                }
+            });
+            total = 0;
+            for(size_t i = 0; i < count; i += count / 1000 + 1)
+                total += int(target[i]) + int(source[i]);
+        };
+
+        std::cout << "\nTRIVIAL VS GENERIC VECTOR PATHS\n";
+        std::cout << "ELEMENTS\tTYPE\tGROW (ns/elem)\tCOPY (ns/elem)\n";
+        const size_t COUNTS[] = {1000, 1000000, 100000000};
+        const int REPEATS[] = {20000, 20, 1};
+        bool same = true;
+        for(int row = 0; row < 3; row++)
+        {
+            double grow, copy;
+            long trivialTotal, genericTotal;
+            double work = double(COUNTS[row]) * REPEATS[row] / 1e9;
+
+            benchmark(int(), COUNTS[row], REPEATS[row], grow, copy, trivialTotal);
+            std::cout << COUNTS[row] << "\tint\t" << grow / work << "\t\t" << copy / work << "\n";
+            benchmark(Boxed(), COUNTS[row], REPEATS[row], grow, copy, genericTotal);
+            std::cout << COUNTS[row] << "\tBoxed\t" << grow / work << "\t\t" << copy / work << "\n";
+            same = same && trivialTotal == genericTotal;
+        }
+        check("both paths hold the same elements", same);
+    }
+    #endif // TRIVIAL_TEST
+
+    // Memory Mapped Vector Test Section
+    #ifdef MAPPED_TEST
+    {
+        // BENCHMARK: getting a 400MB dataset back at startup. The old way reads the file and
+        // pushes every element through push_back; Vector::load reads it in one go into a
+        // reserved buffer; reopening a MappedVector is one mmap, and the pages are only read
+        // when touched. Every file was just written, so they're all in the page cache and this
+        // measures the CPU side, not the disk.
+        const size_t COUNT = 100000000;
+        const std::string MAPPED_FILE = "mapped-vector-test.bin";
+        const std::string RAW_FILE = "raw-vector-test.bin";
+        const std::string SAVED_FILE = "saved-vector-test.bin";
+        std::remove(MAPPED_FILE.c_str());
+
+        {
+            MappedVector<uint32_t> mapped(MAPPED_FILE);
+            mapped.reserve(COUNT);
+            for(size_t i = 0; i < COUNT; i++)
+                mapped.push_back(uint32_t(i * 2654435761u));
+            mapped.sync();
+
+            std::ofstream raw(RAW_FILE, std::ios::binary);
+            raw.write(reinterpret_cast<const char*>(mapped.data()), COUNT * sizeof(uint32_t));
+        }
+
+        // The same elements, saved by Vector
+        {
+            std::ifstream raw(RAW_FILE, std::ios::binary);
+            Vector<uint32_t> staging(static_cast<int>(COUNT));
+            std::vector<uint32_t> chunk(1 << 16);
+            while(raw.read(reinterpret_cast<char*>(chunk.data()), chunk.size() * sizeof(uint32_t)) || raw.gcount())
+                staging.insert(staging.size(), chunk.begin(), chunk.begin() + raw.gcount() / sizeof(uint32_t));
+            std::ofstream saved(SAVED_FILE, std::ios::binary);
+            staging.save(saved);
+        }
+
+        uint64_t pushedSum = 0, loadedSum = 0, mappedSum = 0;
+        Vector<uint32_t> pushed;
+        double pushTime = timeIt([&]()
+        {
+            std::ifstream raw(RAW_FILE, std::ios::binary);
+            std::vector<uint32_t> chunk(1 << 16);
+            while(raw.read(reinterpret_cast<char*>(chunk.data()), chunk.size() * sizeof(uint32_t)) || raw.gcount())
+                for(size_t i = 0; i < raw.gcount() / sizeof(uint32_t); i++)
+                    pushed.push_back(chunk[i]);
+        });
+        double pushScan = timeIt([&]() { pushedSum = std::accumulate(pushed.begin(), pushed.end(), uint64_t(0)); });
+        pushed.clear();
+        pushed.shrink_to_fit();
+
+        Vector<uint32_t> loaded;
+        double loadTime = timeIt([&]()
+        {
+            std::ifstream saved(SAVED_FILE, std::ios::binary);
+            loaded.load(saved);
+        });
+        double loadScan = timeIt([&]() { loadedSum = std::accumulate(loaded.begin(), loaded.end(), uint64_t(0)); });
+        size_t loadedSize = loaded.size();
+        loaded.clear();
+        loaded.shrink_to_fit();
+
+        size_t mappedSize = 0;
+        double openTime = 0, mappedScan = 0;
+        {
+            std::unique_ptr<MappedVector<uint32_t>> reopened;
+            openTime = timeIt([&]()
+            {
+                reopened = std::make_unique<MappedVector<uint32_t>>(MAPPED_FILE);
+                reopened->advise(AccessPattern::SEQUENTIAL);
+            });
+            mappedScan = timeIt([&]() { mappedSum = std::accumulate(reopened->begin(), reopened->end(), uint64_t(0)); });
+            mappedSize = reopened->size();
+        }
+
+        check("every path got the same " + std::to_string(COUNT) + " elements",
+              loadedSize == COUNT && mappedSize == COUNT && pushedSum == loadedSum && loadedSum == mappedSum);
+        std::cout << "\nSTARTUP LOAD (" << COUNT << " uint32_t, " << (COUNT * sizeof(uint32_t) >> 20) << "MB)\n";
+        std::cout << "PATH\t\t\t\tLOAD\t\tFIRST FULL SCAN\n";
+        std::cout << "read + Vector push_back\t\t" << pushTime * 1000 << "ms\t" << pushScan * 1000 << "ms\n";
+        std::cout << "Vector::load\t\t\t" << loadTime * 1000 << "ms\t" << loadScan * 1000 << "ms\n";
+        std::cout << "MappedVector reopen (mmap)\t" << openTime * 1000 << "ms\t" << mappedScan * 1000 << "ms\n";
+
+        std::remove(MAPPED_FILE.c_str());
+        std::remove(RAW_FILE.c_str());
+        std::remove(SAVED_FILE.c_str());
+    }
+    #endif // MAPPED_TEST
+
+    // Skip List Test Section
+    #ifdef SKIPLIST_TEST
+    {
+        std::cout << "\nSKIP LIST AGAINST std::map\n";
+        std::mt19937 random(131);
+        std::uniform_int_distribution<int> keys(0, 999);
+        std::uniform_int_distribution<int> operations(0, 2);
+
+        // Same random operations on both, every answer has to match
+        SkipList<int, int> skipList;
+        std::map<int, int> reference;
+        auto same = [](const SkipList<int, int>& list, const std::map<int, int>& map)
+        {
+            return list.size() == map.size() &&
+                   std::equal(list.begin(), list.end(), map.begin(), map.end(),
+                              [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first && lhs.second == rhs.second; });
+        };
+
+        bool inserts = true, erases = true, searches = true, ranges = true, contents = true;
+        for(int step = 0; step < 50000; step++)
+        {
+            int key = keys(random);
+            switch(operations(random))
+            {
+                case 0:
+                {
+                    bool added = reference.find(key) == reference.end();
+                    reference[key] = step;
+                    inserts = inserts && skipList.insert(key, step) == added;
+                    break;
+                }
+                case 1:
+                    erases = erases && skipList.erase(key) == (reference.erase(key) == 1);
+                    break;
+                default:
+                {
+                    auto found = reference.find(key);
+                    const int* value = skipList.search(key);
+                    searches = searches && (found == reference.end() ? value == nullptr : value && *value == found->second) &&
+                               skipList.contains(key) == (found != reference.end());
+                    break;
+                }
+            }
+
+            if(step % 1000 == 0)
+            {
+                int low = keys(random);
+                int high = low + keys(random) / 4;
+                auto range = skipList.range(low, high);
+                ranges = ranges && std::equal(range.begin(), range.end(), reference.lower_bound(low), reference.lower_bound(high),
+                                              [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; });
+                auto lower = skipList.lower_bound(low);
+                ranges = ranges && (reference.lower_bound(low) == reference.end() ? lower == skipList.end()
+                                                                                  : lower->first == reference.lower_bound(low)->first);
+                contents = contents && same(skipList, reference);
+            }
+        }
+        check("insert() results", inserts);
+        check("erase() results", erases);
+        check("search() and contains() results", searches);
+        check("range() and lower_bound() results", ranges);
+        check("contents in key order", contents && same(skipList, reference));
+
+        SkipList<int, int> copy(skipList);
+        std::map<int, int> copyReference = reference;
+        copy.insert(5000, 1);
+        copy.erase(reference.begin()->first);
+        copyReference.insert({5000, 1});
+        copyReference.erase(reference.begin()->first);
+        check("a copy has the same contents and changes on its own",
+              same(copy, copyReference) && same(skipList, reference));
+        copy = skipList;
+        check("copy assignment", same(copy, reference));
+        skipList.clear();
+        check("clear()", skipList.size() == 0 && skipList.begin() == skipList.end() && !skipList.contains(reference.begin()->first));
+
+        // BENCHMARK: insert and search random keys. SLL is kept small, its search is a linear
+        // walk. BST has no public insert or search, so it's built through load() (one insertNode
+        // per key) and std::map stands in as the balanced tree for searches.
+        auto benchmark = [&](size_t count, bool withList)
+        {
+            std::vector<int> order(count);
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), random);
+            volatile long sink = 0;
+
+            SkipList<int, int> list;
+            double listInsert = timeIt([&]() { for(int key : order) list.insert(key, key); });
+            double listSearch = timeIt([&]() { for(int key : order) sink = sink + *list.search(key); });
+
+            std::map<int, int> map;
+            double mapInsert = timeIt([&]() { for(int key : order) map.emplace(key, key); });
+            double mapSearch = timeIt([&]() { for(int key : order) sink = sink + map.find(key)->second; });
+
+            // The layout BST::save() writes: a header, then key/value pairs
+            struct Entry { int first; int second; };
+            std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+            writeHeader<Entry>(stream, ContainerTag::BST, count);
+            for(int key : order)
+            {
+                writeElement(stream, key);
+                writeElement(stream, key);
+            }
+            BST<int, int> tree;
+            double treeInsert = timeIt([&]() { tree.load(stream); });
+
+            std::cout << count << "\tSkipList\t" << listInsert * 1000 << "ms\t" << listSearch * 1000 << "ms\n";
+            std::cout << count << "\tstd::map\t" << mapInsert * 1000 << "ms\t" << mapSearch * 1000 << "ms\n";
+            std::cout << count << "\tBST\t\t" << treeInsert * 1000 << "ms\t-\n";
+
+            if(withList)
+            {
+                SLL<int> sll;
+                double sllInsert = timeIt([&]() { for(int key : order) sll.push_front(key); });
+                double sllSearch = timeIt([&]() { for(int key : order) sink = sink + (sll.search(key) != nullptr); });
+                std::cout << count << "\tSLL\t\t" << sllInsert * 1000 << "ms\t" << sllSearch * 1000 << "ms\n";
+            }
+        };
+
+        std::cout << "\nSKIP LIST BENCHMARK (random keys)\n";
+        std::cout << "KEYS\tCONTAINER\tINSERT\tSEARCH\n";
+        benchmark(20000, true);
+        benchmark(1000000, false);
+    }
+    #endif // SKIPLIST_TEST
+
+    // Structure Of Arrays Vector Test Section
+    #ifdef SOA_TEST
+    {
+        std::cout << "\nSOA VECTOR\n";
+        SoAVector<int, double, char> records;
+        for(int i = 0; i < 100; i++)
+            records.push_back(i, i * 0.5, char('a' + i % 26));
+
+        // All of these only need a const SoAVector, and have to compile in C++ 17
+        const SoAVector<int, double, char>& readOnly = records;
+        auto [ids, count] = readOnly.columnView<0>();
+        check("size(), capacity() and empty() of a const SoAVector",
+              readOnly.size() == 100 && readOnly.capacity() >= 100 && !readOnly.empty());
+        check("column<I>().size() matches size()",
+              readOnly.column<0>().size() == 100 && readOnly.column<1>().size() == 100 && readOnly.column<2>().size() == 100);
+        check("columnView<I>() points at the column", ids == readOnly.column<0>().data() && count == 100 &&
+              std::accumulate(ids, ids + count, 0) == 4950);
+        check("a row is put together from the columns",
+              std::get<0>(readOnly[42]) == 42 && std::get<1>(readOnly[42]) == 21.0 && std::get<2>(readOnly[42]) == 'q');
+
+        records.columnData<1>()[0] = 7.5;
+        records.pop_back();
+        check("columnData<I>() writes and pop_back() shrinks every column",
+              std::get<1>(records.front()) == 7.5 && records.size() == 99 && readOnly.columnView<2>().second == 99);
+
+        // BENCHMARK: sum one field of every record. The AoS scan drags the whole 32 byte record
+        // through the cache for each 8 byte double, the SoA scan reads nothing but doubles.
+        struct Particle
+        {
+            double x, y, z;
+            int id;
+            float mass;
+        };
+        const size_t COUNT = 4000000;
+        const int PASSES = 10;
+        Vector<Particle> aos(static_cast<int>(COUNT));
+        SoAVector<double, double, double, int, float> soa;
+        soa.reserve(COUNT);
+        for(size_t i = 0; i < COUNT; i++)
+        {
+            double value = double(i % 1000);
+            aos.push_back(Particle{value, -value, value * 2, int(i), 1.0f});
+            soa.push_back(value, -value, value * 2, int(i), 1.0f);
+        }
+
+        volatile double sink = 0;
+        double aosSum = 0;
+        double soaSum = 0;
+        double aosTime = timeIt([&]()
+        {
+            for(int pass = 0; pass < PASSES; pass++)
+            {
+                double sum = 0;
+                const Particle* particles = aos.data();
+                for(size_t i = 0; i < COUNT; i++)
+                    sum += particles[i].x;
+                aosSum = sum;
+                sink = sum;
+            }
+        });
+        double soaTime = timeIt([&]()
+        {
+            for(int pass = 0; pass < PASSES; pass++)
+            {
+                auto [x, size] = soa.columnView<0>();
+                double sum = 0;
+                for(size_t i = 0; i < size; i++)
+                    sum += x[i];
+                soaSum = sum;
+                sink = sum;
+            }
+        });
+
+        check("AoS and SoA scans agree", aosSum == soaSum);
+        std::cout << "\nFIELD SCAN (" << COUNT << " records of " << sizeof(Particle) << " bytes, " << PASSES << " passes)\n";
+        std::cout << "AoS Vector<Particle>\t" << aosTime * 1000 << "ms\n";
+        std::cout << "SoAVector column\t" << soaTime * 1000 << "ms\n";
+        std::cout << "SPEEDUP\t\t\t" << aosTime / soaTime << "x\n";
+    }
+    #endif // SOA_TEST
+
+    // Copy-On-Write Vector Test Section
+    #ifdef COW_TEST
+    {
+        std::cout << "\nCOW VECTOR SNAPSHOTS\n";
+        // Strings, so a read of a freed element is caught by a sanitizer (and usually shows as garbage)
+        using Strings = CowVector<std::string>;
+        auto holds = [](const Strings& vector, std::vector<std::string> expected)
+        {
+            return std::equal(vector.begin(), vector.end(), expected.begin(), expected.end());
+        };
+
+        static_assert(std::is_same<decltype(std::declval<Strings&>().emplace_back()), const std::string&>::value,
+                      "emplace_back must not hand out a writable element");
+
+        Strings original;
+        original.push_back("alpha");
+        original.emplace_back("beta");
+        original.push_back("gamma");
+
+        {
+            Strings snapshot = original;
+            check("a copy shares the buffer", snapshot.isShared() && original.useCount() == 2 && snapshot.data() == original.data());
+
+            original.set(0, "changed");
+            check("set() detaches, the snapshot keeps the old value",
+                  holds(snapshot, {"alpha", "beta", "gamma"}) && holds(original, {"changed", "beta", "gamma"}) && !snapshot.isShared());
+        }
+
+        // Each of these changes original while a snapshot shares its buffer, using one of
+        // the shared elements as the argument: it has to be copied before the buffer is left
+        {
+            Strings snapshot = original;
+            original.set(2, original[1]);
+            check("set() with an element of the shared buffer",
+                  holds(original, {"changed", "beta", "beta"}) && holds(snapshot, {"changed", "beta", "gamma"}));
+        }
+        {
+            Strings snapshot = original;
+            original.push_back(original[0]);
+            check("push_back() with an element of the shared buffer",
+                  holds(original, {"changed", "beta", "beta", "changed"}) && holds(snapshot, {"changed", "beta", "beta"}));
+        }
+        {
+            Strings snapshot = original;
+            original.insertAt(0, original.back());
+            check("insertAt() with an element of the shared buffer",
+                  holds(original, {"changed", "changed", "beta", "beta", "changed"}) &&
+                  holds(snapshot, {"changed", "beta", "beta", "changed"}));
+        }
+        {
+            Strings snapshot = original;
+            original.emplace_back(original.front());
+            check("emplace_back() with an element of the shared buffer",
+                  original.size() == 6 && original.back() == "changed" && snapshot.size() == 5);
+        }
+        {
+            Strings snapshot = original;
+            original.erase(0, 2);
+            original.pop_back();
+            original.mutableData()[0] = "written";
+            check("erase(), pop_back() and mutableData() leave the snapshot alone",
+                  holds(original, {"written", "beta", "changed"}) &&
+                  holds(snapshot, {"changed", "changed", "beta", "beta", "changed", "changed"}));
+
+            Strings other = snapshot;
+            snapshot.clear();
+            check("clear() of a shared buffer lets go of it", snapshot.empty() && other.size() == 6 && !other.isShared());
+        }
+        {
+            // Unshared: no clone, the buffer is changed where it is
+            Strings alone;
+            alone.push_back("one");
+            const std::string* before = alone.data();
+            alone.set(0, "two");
+            check("an unshared vector is changed in place", alone.data() == before && alone[0] == "two");
+        }
+
+        // BENCHMARK: fan out 1000 read only snapshots of a 1M element vector, each reader looking
+        // at a few elements. A deep copy pays for every element each time, a CowVector copy only
+        // bumps the reference count. When every reader also writes, both pay for a full copy.
+        const size_t COUNT = 1000000;
+        const int READERS = 1000;
+        std::vector<int> plain(COUNT);
+        std::iota(plain.begin(), plain.end(), 0);
+        CowVector<int> shared(Vector<int>(static_cast<int>(COUNT)));
+        for(size_t i = 0; i < COUNT; i++)
+            shared.push_back(int(i));
+
+        volatile long sink = 0;
+        double deepRead = timeIt([&]()
+        {
+            for(int reader = 0; reader < READERS; reader++)
+            {
+                std::vector<int> snapshot = plain;
+                sink = sink + snapshot[reader] + snapshot[COUNT - 1 - reader];
+            }
+        });
+        double cowRead = timeIt([&]()
+        {
+            for(int reader = 0; reader < READERS; reader++)
+            {
+                CowVector<int> snapshot = shared;
+                sink = sink + snapshot[reader] + snapshot[COUNT - 1 - reader];
+            }
+        });
+        double deepWrite = timeIt([&]()
+        {
+            for(int reader = 0; reader < READERS / 10; reader++)
+            {
+                std::vector<int> snapshot = plain;
+                snapshot[reader] = -1;
+                sink = sink + snapshot[reader];
+            }
+        });
+        double cowWrite = timeIt([&]()
+        {
+            for(int reader = 0; reader < READERS / 10; reader++)
+            {
+                CowVector<int> snapshot = shared;
+                snapshot.set(reader, -1);
+                sink = sink + snapshot[reader];
+            }
+        });
+
+        std::cout << "\nCOW VECTOR FAN-OUT (" << COUNT << " ints)\n";
+        std::cout << READERS << " READ ONLY SNAPSHOTS  deep copy: " << deepRead * 1000 << "ms  CowVector: " << cowRead * 1000 << "ms\n";
+        std::cout << READERS / 10 << " SNAPSHOTS THAT WRITE  deep copy: " << deepWrite * 1000 << "ms  CowVector: " << cowWrite * 1000 << "ms\n";
+    }
+    #endif // COW_TEST
+
     #ifdef BST_TEST
     
     BST<int, char> myTree;